@@ -233,9 +233,11 @@ lbool lackr::eager() {
         return l_false;
     }
     eager_enc();
-    expr_ref all = mk_and(m_ackrs);
-    m_simp(all);
-    m_solver->assert_expr(all);
+    // each lemma was already simplified by ackr(); asserting them one by one
+    // avoids materializing a conjunction that is quadratic in the number of
+    // function applications.
+    for (expr* a : m_ackrs)
+        m_solver->assert_expr(a);
     TRACE(ackermannize, tout << "run sat all\n"; );
     return m_solver->check_sat(0, nullptr);
 }
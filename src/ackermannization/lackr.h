@@ -47,6 +47,12 @@ class lackr {
 
         /** \brief
          * Solve the formula that the class was initialized with.
+         *
+         * With ackermannization.eager=false the congruence lemmas are not
+         * enumerated up-front; a CEGAR loop adds lemmas only for pairs of
+         * applications that clash in a candidate model (see lazy() and
+         * lackr_model_constructor), which avoids the quadratic blowup on
+         * formulas with many applications of the same function.
          **/
         lbool operator() ();
 
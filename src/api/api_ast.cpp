@@ -18,6 +18,7 @@ Revision History:
 #include "api/api_log_macros.h"
 #include "api/api_context.h"
 #include "api/api_util.h"
+#include "api/api_ast_vector.h"
 #include "ast/well_sorted.h"
 #include "ast/arith_decl_plugin.h"
 #include "ast/bv_decl_plugin.h"
@@ -209,6 +210,48 @@ extern "C" {
         Z3_CATCH_RETURN(nullptr);
     }
 
+    Z3_ast_vector Z3_API Z3_mk_apps(Z3_context c, unsigned n, Z3_func_decl const decls[], unsigned const num_args[],
+                                    unsigned num_leaves, Z3_ast const leaves[], unsigned total_args, unsigned const args[]) {
+        Z3_TRY;
+        LOG_Z3_mk_apps(c, n, decls, num_args, num_leaves, leaves, total_args, args);
+        RESET_ERROR_CODE();
+        ast_manager& m = mk_c(c)->m();
+        Z3_ast_vector_ref* v = alloc(Z3_ast_vector_ref, *mk_c(c), m);
+        mk_c(c)->save_object(v);
+        ptr_buffer<expr> arg_list;
+        unsigned offset = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            if (num_args[i] > total_args - offset) {
+                SET_ERROR_CODE(Z3_INVALID_ARG, "argument index array is too short");
+                RETURN_Z3(nullptr);
+            }
+            arg_list.reset();
+            for (unsigned j = 0; j < num_args[i]; ++j) {
+                unsigned k = args[offset + j];
+                if (k < num_leaves)
+                    arg_list.push_back(to_expr(leaves[k]));
+                else if (k - num_leaves < i)
+                    arg_list.push_back(to_expr(of_ast(v->m_ast_vector.get(k - num_leaves))));
+                else {
+                    SET_ERROR_CODE(Z3_INVALID_ARG, "argument index refers to an application that is not built yet");
+                    RETURN_Z3(nullptr);
+                }
+            }
+            offset += num_args[i];
+            func_decl* d = to_func_decl(decls[i]);
+            if (d->is_polymorphic()) {
+                // polymorphic declarations need per-application sort inference; use Z3_mk_app
+                SET_ERROR_CODE(Z3_INVALID_ARG, "polymorphic declarations are not supported in batch construction");
+                RETURN_Z3(nullptr);
+            }
+            app* a = m.mk_app(d, num_args[i], arg_list.data());
+            v->m_ast_vector.push_back(a);
+            check_sorts(c, a);
+        }
+        RETURN_Z3(of_ast_vector(v));
+        Z3_CATCH_RETURN(nullptr);
+    }
+
     Z3_ast Z3_API Z3_mk_const(Z3_context c, Z3_symbol s, Z3_sort ty) {
         Z3_TRY;
         LOG_Z3_mk_const(c, s, ty);
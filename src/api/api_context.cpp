@@ -284,6 +284,12 @@ namespace api {
         m_last_obj = nullptr;
     }
 
+    void context::purge() {
+        flush_objects();
+        m_last_obj = nullptr;
+        m_ast_trail.reset();
+    }
+
     void context::save_object(object * r) {
         m_last_obj = r;
     }
@@ -411,6 +417,14 @@ extern "C" {
         Z3_CATCH;
     }    
 
+    void Z3_API Z3_context_purge(Z3_context c) {
+        Z3_TRY;
+        LOG_Z3_context_purge(c);
+        RESET_ERROR_CODE();
+        mk_c(c)->purge();
+        Z3_CATCH;
+    }
+
     void Z3_API Z3_toggle_warning_messages(bool enabled) {
         LOG_Z3_toggle_warning_messages(enabled);
         enable_warning_messages(enabled != 0);
@@ -440,6 +454,34 @@ extern "C" {
         Z3_CATCH;
     }
 
+    void Z3_API Z3_inc_refs(Z3_context c, unsigned n, Z3_ast const asts[]) {
+        Z3_TRY;
+        LOG_Z3_inc_refs(c, n, asts);
+        RESET_ERROR_CODE();
+        mk_c(c)->flush_objects();
+        for (unsigned i = 0; i < n; ++i)
+            mk_c(c)->m().inc_ref(to_ast(asts[i]));
+        Z3_CATCH;
+    }
+
+    void Z3_API Z3_dec_refs(Z3_context c, unsigned n, Z3_ast const asts[]) {
+        Z3_TRY;
+        LOG_Z3_dec_refs(c, n, asts);
+        for (unsigned i = 0; i < n; ++i) {
+            Z3_ast a = asts[i];
+            if (a && to_ast(a)->get_ref_count() == 0) {
+                // the error is unchecked (but should not happen) in GC'ed wrappers
+                RESET_ERROR_CODE();
+                SET_ERROR_CODE(Z3_DEC_REF_ERROR, nullptr);
+                continue;
+            }
+            if (a) {
+                mk_c(c)->dec_ref(to_ast(a));
+            }
+        }
+        Z3_CATCH;
+    }
+
 
     void Z3_API Z3_get_version(unsigned * major, 
                                unsigned * minor, 
@@ -204,6 +204,10 @@ namespace api {
         // Reset the cache that stores the ASTs exposed in the previous call.
         // This is a NOOP if ref-count is disabled.
         void reset_last_result();
+
+        // Drop every AST pinned on behalf of the client so a pooled context
+        // can be recycled without recreating manager, plugins or parameters.
+        void purge();
         
         // "Save" a reference to an object that is exposed by the API
         void save_object(object * r);
@@ -635,8 +635,16 @@ extern "C" {
     }
 
 #define STRINGIFY(x) #x
-#define TOSTRING(x) STRINGIFY(x)    
-
+#define TOSTRING(x) STRINGIFY(x)
+
+    // Check calls block the calling thread by design. Asynchronous use is
+    // supported by running the check on a caller-owned thread and invoking
+    // Z3_solver_interrupt (or Z3_interrupt) from another thread; interruption
+    // latency is bounded by the reslimit polling the solvers already perform
+    // at propagation and restart boundaries. A future/handle API inside this
+    // layer would have to own threads and expose solver state (statistics,
+    // activity) mid-search, and none of the solver objects support concurrent
+    // readers while a check is running.
     static Z3_lbool _solver_check(Z3_context c, Z3_solver s, unsigned num_assumptions, Z3_ast const assumptions[]) {
         for (unsigned i = 0; i < num_assumptions; i++) {
             if (!is_expr(to_ast(assumptions[i]))) {
@@ -1613,6 +1613,16 @@ extern "C" {
        - Z3 uses hash-consing, i.e., when the same \c Z3_ast is created twice,
          Z3 will return the same pointer twice.
 
+       \remark Sharing a large base context across worker processes: on
+       POSIX systems a context may be built once and then shared
+       copy-on-write by calling \c fork from the thread that owns it while
+       no solver call is in flight. The AST arena and hash-cons tables are
+       ordinary heap pages, so forked workers share them until written to;
+       Z3's internal timer thread is quiesced around \c fork automatically.
+       Workers should treat the inherited terms as frozen: reference count
+       updates or new term creation dirty the shared pages and make them
+       private to the worker.
+
        \sa Z3_del_context
 
        def_API('Z3_mk_context', CONTEXT, (_in(CONFIG),))
@@ -1652,6 +1662,27 @@ extern "C" {
     */
     void Z3_API Z3_del_context(Z3_context c);
 
+    /**
+       \brief Release the terms the context keeps alive on behalf of the client.
+
+       In a context created with #Z3_mk_context every AST returned across the
+       API is pinned by an internal trail, so a long-lived context that serves
+       many requests grows without bound. This call resets the trail so those
+       terms can be reclaimed, while interned declarations, registered
+       plugins, parameter settings and allocator chunks stay warm; recycling
+       a pooled context this way is much cheaper than creating a fresh one.
+       All AST handles previously obtained from the context become invalid.
+       In a reference-counted context (#Z3_mk_context_rc) only the internal
+       pin of the last result is dropped and handles the client still
+       references remain valid.
+
+       \sa Z3_mk_context
+       \sa Z3_solver_reset
+
+       def_API('Z3_context_purge', VOID, (_in(CONTEXT),))
+    */
+    void Z3_API Z3_context_purge(Z3_context c);
+
     /**
        \brief Increment the reference counter of the given AST.
        The context \c c should have been created using #Z3_mk_context_rc.
@@ -1670,6 +1701,29 @@ extern "C" {
     */
     void Z3_API Z3_dec_ref(Z3_context c, Z3_ast a);
 
+    /**
+       \brief Increment the reference counters of an array of ASTs.
+       Equivalent to calling #Z3_inc_ref on each element of \c asts, but
+       crosses the API boundary only once. Intended for bindings that
+       batch reference-count maintenance.
+       The context \c c should have been created using #Z3_mk_context_rc.
+
+       def_API('Z3_inc_refs', VOID, (_in(CONTEXT), _in(UINT), _in_array(1, AST)))
+    */
+    void Z3_API Z3_inc_refs(Z3_context c, unsigned n, Z3_ast const asts[]);
+
+    /**
+       \brief Decrement the reference counters of an array of ASTs.
+       Equivalent to calling #Z3_dec_ref on each element of \c asts, but
+       crosses the API boundary only once. Elements whose reference
+       counter is already zero set the error code \c Z3_DEC_REF_ERROR and
+       are skipped; the remaining elements are still processed.
+       The context \c c should have been created using #Z3_mk_context_rc.
+
+       def_API('Z3_dec_refs', VOID, (_in(CONTEXT), _in(UINT), _in_array(1, AST)))
+    */
+    void Z3_API Z3_dec_refs(Z3_context c, unsigned n, Z3_ast const asts[]);
+
     /**
        \brief Set a value of a context parameter.
 
@@ -2257,6 +2311,31 @@ extern "C" {
         unsigned num_args,
         Z3_ast const args[]);
 
+    /**
+       \brief Create many function applications in one call.
+
+       Builds \c n applications and returns them as an AST vector.
+       Application \c i uses function declaration \c decls[i] and
+       consumes \c num_args[i] argument indices from \c args, in order.
+       An argument index \c k with \c k < num_leaves refers to
+       \c leaves[k]; an index \c k >= num_leaves refers to application
+       \c k - num_leaves built earlier in the same batch, which allows a
+       shared sub-term DAG to be constructed in a single API crossing.
+
+       \sa Z3_mk_app
+
+       def_API('Z3_mk_apps', AST_VECTOR, (_in(CONTEXT), _in(UINT), _in_array(1, FUNC_DECL), _in_array(1, UINT), _in(UINT), _in_array(4, AST), _in(UINT), _in_array(6, UINT)))
+    */
+    Z3_ast_vector Z3_API Z3_mk_apps(
+        Z3_context c,
+        unsigned n,
+        Z3_func_decl const decls[],
+        unsigned const num_args[],
+        unsigned num_leaves,
+        Z3_ast const leaves[],
+        unsigned total_args,
+        unsigned const args[]);
+
     /**
        \brief Declare and create a constant.
 
@@ -3502,6 +3581,19 @@ extern "C" {
     */
     Z3_ast Z3_API Z3_mk_int64(Z3_context c, int64_t v, Z3_sort ty);
 
+    /**
+       \brief Create many numerals of an int, bit-vector, or finite-domain sort in one call.
+
+       Equivalent to calling #Z3_mk_int on each element of \c values,
+       but crosses the API boundary only once. The numerals are returned
+       as an AST vector in the order of \c values.
+
+       \sa Z3_mk_int
+
+       def_API('Z3_mk_ints', AST_VECTOR, (_in(CONTEXT), _in(UINT), _in_array(1, INT), _in(SORT)))
+    */
+    Z3_ast_vector Z3_API Z3_mk_ints(Z3_context c, unsigned n, int const values[], Z3_sort ty);
+
     /**
        \brief Create a numeral of a int, bit-vector, or finite-domain sort.
 
@@ -75,7 +75,7 @@ void act_cache::init() {
 void act_cache::dec_refs() {
     for (auto & kv : m_table) {
         m_manager.dec_ref(kv.m_key.first);
-        m_manager.dec_ref(UNTAG(expr*, kv.m_value));
+        m_manager.dec_ref(UNTAG(expr*, kv.m_value.m_val));
     }
 }
 
@@ -108,11 +108,13 @@ void act_cache::del_unused() {
         SASSERT(m_table.contains(e));
         map::key_value * entry = m_table.find_core(e);
         SASSERT(entry);
-        if (GET_TAG(entry->m_value) == 0) {
+        if (GET_TAG(entry->m_value.m_val) == 0) {
             // Key k was never accessed by client code.
             // That is, find(k) was never executed by client code.
             m_unused--;
-            expr * v = entry->m_value;
+            if (entry->m_value.m_gen == m_generation)
+                m_cur_size--;
+            expr * v = entry->m_value.m_val;
             m_table.erase(e);
             m_manager.dec_ref(e.first);
             m_manager.dec_ref(v);
@@ -139,7 +141,7 @@ void act_cache::insert(expr * k, unsigned offset, expr * v) {
     if (m_unused >= m_max_unused)
         del_unused();
     expr * dummy = reinterpret_cast<expr*>(1);
-    map::key_value & entry = m_table.insert_if_not_there(e, dummy);
+    map::key_value & entry = m_table.insert_if_not_there(e, value_t(dummy, m_generation));
 #if 0
     unsigned static counter = 0;
     counter++;
@@ -150,33 +152,39 @@ void act_cache::insert(expr * k, unsigned offset, expr * v) {
 #ifdef Z3DEBUG
     unsigned expected_tag;
 #endif
-    if (entry.m_value == dummy) {
+    if (entry.m_value.m_val == dummy) {
         // new entry;
         m_manager.inc_ref(k);
         m_manager.inc_ref(v);
-        entry.m_value = v;
+        entry.m_value.m_val = v;
         m_queue.push_back(e);
         m_unused++;
+        m_cur_size++;
         DEBUG_CODE(expected_tag = 0;); // new entry
     }
-    else if (UNTAG(expr*, entry.m_value) == v) {
+    else if (UNTAG(expr*, entry.m_value.m_val) == v && entry.m_value.m_gen == m_generation) {
         // already there
-        DEBUG_CODE(expected_tag = GET_TAG(entry.m_value);); 
+        DEBUG_CODE(expected_tag = GET_TAG(entry.m_value.m_val););
     }
     else {
-        // replacing old entry
+        // replacing an old or stale entry
         m_manager.inc_ref(v);
-        m_manager.dec_ref(UNTAG(expr*, entry.m_value));
-        entry.m_value = v;
-        SASSERT(GET_TAG(entry.m_value) == 0);
+        m_manager.dec_ref(UNTAG(expr*, entry.m_value.m_val));
+        entry.m_value.m_val = v;
+        if (entry.m_value.m_gen != m_generation) {
+            entry.m_value.m_gen = m_generation;
+            m_cur_size++;
+        }
+        SASSERT(GET_TAG(entry.m_value.m_val) == 0);
         // replaced old entry, and reset the tag.
-        DEBUG_CODE(expected_tag = 0;); 
+        DEBUG_CODE(expected_tag = 0;);
     }
     DEBUG_CODE({
-        expr * v2;
+        value_t v2;
         SASSERT(m_table.find(e, v2));
-        SASSERT(v == UNTAG(expr*, v2));
-        SASSERT(expected_tag == GET_TAG(v2));
+        SASSERT(v == UNTAG(expr*, v2.m_val));
+        SASSERT(expected_tag == GET_TAG(v2.m_val));
+        SASSERT(v2.m_gen == m_generation);
     });
 }
 
@@ -189,26 +197,47 @@ expr * act_cache::find(expr * k, unsigned offset) {
     map::key_value * entry = m_table.find_core(e);
     if (entry == nullptr)
         return nullptr;
-    if (GET_TAG(entry->m_value) == 0) {
-        entry->m_value = TAG(expr*, entry->m_value, 1);
-        SASSERT(GET_TAG(entry->m_value) == 1);
+    if (entry->m_value.m_gen != m_generation)
+        // Stale entry from before the last reset(). It is reclaimed when its
+        // key is reinserted, by del_unused, or by the next full flush.
+        return nullptr;
+    if (GET_TAG(entry->m_value.m_val) == 0) {
+        entry->m_value.m_val = TAG(expr*, entry->m_value.m_val, 1);
+        SASSERT(GET_TAG(entry->m_value.m_val) == 1);
         SASSERT(m_unused > 0);
         m_unused--;
         DEBUG_CODE({
-            expr * v;
+            value_t v;
             SASSERT(m_table.find(e, v));
-            SASSERT(GET_TAG(v) == 1);
+            SASSERT(GET_TAG(v.m_val) == 1);
         });
     }
-    return UNTAG(expr*, entry->m_value);
+    return UNTAG(expr*, entry->m_value.m_val);
 }
 
-void act_cache::reset() {
+void act_cache::flush() {
     dec_refs();
     m_table.reset();
     m_queue.reset();
     m_unused = 0;
     m_qhead = 0;
+    m_generation = 0;
+    m_cur_size = 0;
+}
+
+void act_cache::reset() {
+    if (m_cur_size == 0 && m_table.empty())
+        return;
+    if (m_table.size() > m_max_unused || m_generation == UINT_MAX) {
+        // Too many stale entries (or generation counter about to wrap):
+        // fall back to an eager flush that releases all references.
+        flush();
+        return;
+    }
+    // O(1) reset: bump the generation; existing entries become stale and
+    // are evicted lazily.
+    m_generation++;
+    m_cur_size = 0;
 }
 
 void act_cache::cleanup() {
@@ -217,6 +246,8 @@ void act_cache::cleanup() {
     m_queue.finalize();
     m_unused = 0;
     m_qhead = 0;
+    m_generation = 0;
+    m_cur_size = 0;
 }
 
 bool act_cache::check_invariant() const {
@@ -31,17 +31,28 @@ class act_cache {
             return e.first->hash() + e.second;
         }
     };
-    typedef cmap<entry_t, expr*, entry_hash, default_eq<entry_t> > map;
+    // Cached value tagged with the generation it was inserted at.
+    // Entries from older generations are treated as misses and reclaimed lazily.
+    struct value_t {
+        expr *   m_val = nullptr;
+        unsigned m_gen = 0;
+        value_t() = default;
+        value_t(expr * v, unsigned g):m_val(v), m_gen(g) {}
+    };
+    typedef cmap<entry_t, value_t, entry_hash, default_eq<entry_t> > map;
     map                  m_table;
     svector<entry_t>     m_queue; // recently created queue
     unsigned             m_qhead;
     unsigned             m_unused;
     unsigned             m_max_unused;
+    unsigned             m_generation = 0;
+    unsigned             m_cur_size = 0; // number of entries of the current generation
 
     void compress_queue();
     void init();
     void dec_refs();
     void del_unused();
+    void flush();
 
 public:
     act_cache(ast_manager & m);
@@ -53,9 +64,9 @@ public:
     expr * find(expr * k, unsigned offset);
     void reset();
     void cleanup();
-    unsigned size() const { return m_table.size(); }
+    unsigned size() const { return m_cur_size; }
     unsigned capacity() const { return m_table.capacity(); }
-    bool empty() const { return m_table.empty(); }
+    bool empty() const { return m_cur_size == 0; }
     bool check_invariant() const;
     
 };
@@ -1321,6 +1321,7 @@ void ast_manager::update_fresh_id(ast_manager const& m) {
 
 
 void ast_manager::init() {
+    m_alloc.set_domain(memory::DOMAIN_AST);
     m_int_real_coercions = true;
     m_debug_ref_count = false;
     m_fresh_id = 0;
@@ -2869,6 +2870,17 @@ proof * ast_manager::mk_transitivity(proof * p1, proof * p2) {
         return p2;
     if (is_reflexivity(p2))
         return p1;
+    // chain compression: adjacent rewrite steps carry no premises, so a
+    // sequence of them is summarized by a single rewrite between the endpoints.
+    if (is_rewrite(p2) && is_eq(fact2)) {
+        if (is_rewrite(p1) && is_eq(fact1))
+            return mk_rewrite(fact1->get_arg(0), fact2->get_arg(1));
+        if (is_transitivity(p1) && is_rewrite(get_parent(p1, 1))) {
+            app* last = to_app(get_fact(get_parent(p1, 1)));
+            if (is_eq(last))
+                return mk_transitivity(get_parent(p1, 0), mk_rewrite(last->get_arg(0), fact2->get_arg(1)));
+        }
+    }
     // local fixup to admit inline simplifications of not(not(e)) to e
     expr* e;
     if (is_not(fact1->get_arg(1), e) && is_not(e, e) && e == fact2->get_arg(0))
@@ -2923,7 +2935,13 @@ proof * ast_manager::mk_monotonicity(func_decl * R, app * f1, app * f2, unsigned
     SASSERT(f1->get_num_args() == f2->get_num_args());
     SASSERT(f1->get_decl() == f2->get_decl());
     ptr_buffer<expr> args;
-    args.append(num_proofs, (expr**) proofs);
+    // positions with syntactically equal arguments need no justification,
+    // so reflexivity premises are dropped.
+    for (unsigned i = 0; i < num_proofs; i++)
+        if (!is_reflexivity(proofs[i]))
+            args.push_back(proofs[i]);
+    if (args.empty() && f1 == f2)
+        return mk_app(basic_family_id, PR_REFLEXIVITY, mk_app(R, f1, f2));
     args.push_back(mk_app(R, f1, f2));
     proof* p = mk_app(basic_family_id, PR_MONOTONICITY, args.size(), args.data());
     return p;
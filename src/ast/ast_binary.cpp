@@ -0,0 +1,571 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    ast_binary.cpp
+
+Abstract:
+
+    Versioned binary serialization of AST DAGs.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+--*/
+#include "ast/ast_binary.h"
+#include "util/map.h"
+#include "util/zstring.h"
+#include <cstring>
+
+static const char BIN_MAGIC[4] = { 'Z', '3', 'B', 'F' };
+static const unsigned BIN_VERSION = 1;
+
+// record tags
+static const unsigned char TAG_END        = 0;
+static const unsigned char TAG_SORT       = 1;
+static const unsigned char TAG_FUNC_DECL  = 2;
+static const unsigned char TAG_APP        = 3;
+static const unsigned char TAG_VAR        = 4;
+static const unsigned char TAG_QUANTIFIER = 5;
+
+// symbol tags
+static const unsigned char SYM_NULL    = 0;
+static const unsigned char SYM_NUM     = 1;
+static const unsigned char SYM_NEW     = 2;
+static const unsigned char SYM_BACKREF = 3;
+
+// parameter tags
+static const unsigned char PAR_INT      = 0;
+static const unsigned char PAR_AST      = 1;
+static const unsigned char PAR_SYMBOL   = 2;
+static const unsigned char PAR_RATIONAL = 3;
+static const unsigned char PAR_DOUBLE   = 4;
+static const unsigned char PAR_ZSTRING  = 5;
+
+namespace {
+
+    struct serializer {
+        std::ostream &         m_out;
+        ast_manager &          m;
+        obj_map<ast, unsigned> m_ids;
+        map<symbol, unsigned, symbol_hash_proc, symbol_eq_proc> m_sym_ids;
+        ptr_vector<ast>        m_todo;
+        family_id              m_dt_fid;
+
+        serializer(std::ostream & out, ast_manager & m):
+            m_out(out),
+            m(m),
+            m_dt_fid(m.mk_family_id("datatype")) {
+        }
+
+        void write_u8(unsigned char b) {
+            m_out.put(static_cast<char>(b));
+        }
+
+        void write_u32(unsigned v) {
+            // little endian, independently of the host
+            write_u8(v & 0xFF);
+            write_u8((v >> 8) & 0xFF);
+            write_u8((v >> 16) & 0xFF);
+            write_u8((v >> 24) & 0xFF);
+        }
+
+        void write_str(char const * s, unsigned len) {
+            write_u32(len);
+            m_out.write(s, len);
+        }
+
+        void write_str(std::string const & s) {
+            write_str(s.c_str(), static_cast<unsigned>(s.size()));
+        }
+
+        void write_sym(symbol const & s) {
+            if (s.is_null()) {
+                write_u8(SYM_NULL);
+                return;
+            }
+            if (s.is_numerical()) {
+                write_u8(SYM_NUM);
+                write_u32(s.get_num());
+                return;
+            }
+            unsigned idx;
+            if (m_sym_ids.find(s, idx)) {
+                write_u8(SYM_BACKREF);
+                write_u32(idx);
+                return;
+            }
+            m_sym_ids.insert(s, m_sym_ids.size());
+            write_u8(SYM_NEW);
+            char const * str = s.bare_str();
+            write_str(str, static_cast<unsigned>(strlen(str)));
+        }
+
+        unsigned id_of(ast * n) const {
+            return m_ids.find(n);
+        }
+
+        void write_param(parameter const & p) {
+            switch (p.get_kind()) {
+            case parameter::PARAM_INT:
+                write_u8(PAR_INT);
+                write_u32(static_cast<unsigned>(p.get_int()));
+                break;
+            case parameter::PARAM_AST:
+                write_u8(PAR_AST);
+                write_u32(id_of(p.get_ast()));
+                break;
+            case parameter::PARAM_SYMBOL:
+                write_u8(PAR_SYMBOL);
+                write_sym(p.get_symbol());
+                break;
+            case parameter::PARAM_RATIONAL:
+                write_u8(PAR_RATIONAL);
+                write_str(p.get_rational().to_string());
+                break;
+            case parameter::PARAM_DOUBLE: {
+                write_u8(PAR_DOUBLE);
+                uint64_t bits;
+                double d = p.get_double();
+                memcpy(&bits, &d, sizeof(bits));
+                write_u32(static_cast<unsigned>(bits & 0xFFFFFFFF));
+                write_u32(static_cast<unsigned>(bits >> 32));
+                break;
+            }
+            case parameter::PARAM_ZSTRING:
+                write_u8(PAR_ZSTRING);
+                write_str(p.get_zstring().encode());
+                break;
+            default:
+                // PARAM_EXTERNAL values are plugin-internal and have no
+                // process-independent representation.
+                throw default_exception("binary AST format does not support external parameters");
+            }
+        }
+
+        void write_params(unsigned num, parameter const * ps) {
+            write_u32(num);
+            for (unsigned i = 0; i < num; i++)
+                write_param(ps[i]);
+        }
+
+        bool visit(ast * n) {
+            if (m_ids.contains(n))
+                return true;
+            m_todo.push_back(n);
+            return false;
+        }
+
+        bool visit_params(unsigned num, parameter const * ps) {
+            bool ok = true;
+            for (unsigned i = 0; i < num; i++)
+                if (ps[i].is_ast() && !visit(ps[i].get_ast()))
+                    ok = false;
+            return ok;
+        }
+
+        bool visit_children(ast * n) {
+            bool ok = true;
+            switch (n->get_kind()) {
+            case AST_SORT:
+                ok = visit_params(to_sort(n)->get_num_parameters(), to_sort(n)->get_parameters());
+                break;
+            case AST_FUNC_DECL: {
+                func_decl * f = to_func_decl(n);
+                ok = visit_params(f->get_num_parameters(), f->get_parameters());
+                for (unsigned i = 0; i < f->get_arity(); i++)
+                    if (!visit(f->get_domain(i)))
+                        ok = false;
+                if (!visit(f->get_range()))
+                    ok = false;
+                break;
+            }
+            case AST_APP: {
+                app * a = to_app(n);
+                if (!visit(a->get_decl()))
+                    ok = false;
+                for (expr * arg : *a)
+                    if (!visit(arg))
+                        ok = false;
+                break;
+            }
+            case AST_VAR:
+                ok = visit(to_var(n)->get_sort());
+                break;
+            case AST_QUANTIFIER: {
+                quantifier * q = to_quantifier(n);
+                for (unsigned i = 0; i < q->get_num_decls(); i++)
+                    if (!visit(q->get_decl_sort(i)))
+                        ok = false;
+                if (!visit(q->get_expr()))
+                    ok = false;
+                for (unsigned i = 0; i < q->get_num_patterns(); i++)
+                    if (!visit(q->get_pattern(i)))
+                        ok = false;
+                for (unsigned i = 0; i < q->get_num_no_patterns(); i++)
+                    if (!visit(q->get_no_pattern(i)))
+                        ok = false;
+                break;
+            }
+            default:
+                UNREACHABLE();
+            }
+            return ok;
+        }
+
+        void write_node(ast * n) {
+            switch (n->get_kind()) {
+            case AST_SORT: {
+                sort * s = to_sort(n);
+                write_u8(TAG_SORT);
+                if (s->get_family_id() != null_family_id) {
+                    if (s->get_family_id() == m_dt_fid)
+                        // datatype sorts require plugin-side registration of the
+                        // datatype declaration; they cannot be reconstructed from
+                        // the sort record alone.
+                        throw default_exception("binary AST format does not support datatype sorts");
+                    write_u8(1);
+                    write_sym(m.get_family_name(s->get_family_id()));
+                    write_u32(static_cast<unsigned>(s->get_decl_kind()));
+                }
+                else {
+                    write_u8(0);
+                    write_sym(s->get_name());
+                }
+                write_params(s->get_num_parameters(), s->get_parameters());
+                break;
+            }
+            case AST_FUNC_DECL: {
+                func_decl * f = to_func_decl(n);
+                write_u8(TAG_FUNC_DECL);
+                if (f->get_family_id() != null_family_id) {
+                    write_u8(1);
+                    write_sym(m.get_family_name(f->get_family_id()));
+                    write_u32(static_cast<unsigned>(f->get_decl_kind()));
+                    write_params(f->get_num_parameters(), f->get_parameters());
+                    write_u32(f->get_arity());
+                    for (unsigned i = 0; i < f->get_arity(); i++)
+                        write_u32(id_of(f->get_domain(i)));
+                }
+                else {
+                    write_u8(0);
+                    write_sym(f->get_name());
+                    write_u32(f->get_arity());
+                    for (unsigned i = 0; i < f->get_arity(); i++)
+                        write_u32(id_of(f->get_domain(i)));
+                    write_u32(id_of(f->get_range()));
+                }
+                break;
+            }
+            case AST_APP: {
+                app * a = to_app(n);
+                write_u8(TAG_APP);
+                write_u32(id_of(a->get_decl()));
+                write_u32(a->get_num_args());
+                for (expr * arg : *a)
+                    write_u32(id_of(arg));
+                break;
+            }
+            case AST_VAR:
+                write_u8(TAG_VAR);
+                write_u32(to_var(n)->get_idx());
+                write_u32(id_of(to_var(n)->get_sort()));
+                break;
+            case AST_QUANTIFIER: {
+                quantifier * q = to_quantifier(n);
+                write_u8(TAG_QUANTIFIER);
+                write_u8(static_cast<unsigned char>(q->get_kind()));
+                write_u32(q->get_num_decls());
+                for (unsigned i = 0; i < q->get_num_decls(); i++) {
+                    write_sym(q->get_decl_name(i));
+                    write_u32(id_of(q->get_decl_sort(i)));
+                }
+                write_u32(id_of(q->get_expr()));
+                write_u32(static_cast<unsigned>(q->get_weight()));
+                write_sym(q->get_qid());
+                write_sym(q->get_skid());
+                write_u32(q->get_num_patterns());
+                for (unsigned i = 0; i < q->get_num_patterns(); i++)
+                    write_u32(id_of(q->get_pattern(i)));
+                write_u32(q->get_num_no_patterns());
+                for (unsigned i = 0; i < q->get_num_no_patterns(); i++)
+                    write_u32(id_of(q->get_no_pattern(i)));
+                break;
+            }
+            default:
+                UNREACHABLE();
+            }
+        }
+
+        void process(ast * n) {
+            if (m_ids.contains(n))
+                return;
+            m_todo.push_back(n);
+            while (!m_todo.empty()) {
+                ast * t = m_todo.back();
+                if (m_ids.contains(t)) {
+                    m_todo.pop_back();
+                    continue;
+                }
+                if (!visit_children(t))
+                    continue;
+                write_node(t);
+                m_ids.insert(t, m_ids.size());
+                m_todo.pop_back();
+            }
+        }
+
+        void operator()(unsigned num, expr * const * roots) {
+            m_out.write(BIN_MAGIC, sizeof(BIN_MAGIC));
+            write_u32(BIN_VERSION);
+            for (unsigned i = 0; i < num; i++)
+                process(roots[i]);
+            write_u8(TAG_END);
+            write_u32(num);
+            for (unsigned i = 0; i < num; i++)
+                write_u32(id_of(roots[i]));
+        }
+    };
+
+    struct deserializer {
+        std::istream &  m_in;
+        ast_manager &   m;
+        ast_ref_vector  m_nodes;  // dense id -> node, pinned
+        vector<symbol>  m_symbols;
+
+        deserializer(std::istream & in, ast_manager & m):
+            m_in(in),
+            m(m),
+            m_nodes(m) {
+        }
+
+        unsigned char read_u8() {
+            int c = m_in.get();
+            if (c == EOF)
+                throw default_exception("binary AST stream is truncated");
+            return static_cast<unsigned char>(c);
+        }
+
+        unsigned read_u32() {
+            unsigned v = read_u8();
+            v |= static_cast<unsigned>(read_u8()) << 8;
+            v |= static_cast<unsigned>(read_u8()) << 16;
+            v |= static_cast<unsigned>(read_u8()) << 24;
+            return v;
+        }
+
+        std::string read_str() {
+            unsigned len = read_u32();
+            std::string s;
+            s.resize(len);
+            m_in.read(&s[0], len);
+            if (static_cast<unsigned>(m_in.gcount()) != len)
+                throw default_exception("binary AST stream is truncated");
+            return s;
+        }
+
+        symbol read_sym() {
+            switch (read_u8()) {
+            case SYM_NULL:
+                return symbol::null;
+            case SYM_NUM:
+                return symbol(read_u32());
+            case SYM_NEW: {
+                std::string str = read_str();
+                symbol s(str.c_str());
+                m_symbols.push_back(s);
+                return s;
+            }
+            case SYM_BACKREF: {
+                unsigned idx = read_u32();
+                if (idx >= m_symbols.size())
+                    throw default_exception("binary AST stream contains an invalid symbol reference");
+                return m_symbols[idx];
+            }
+            default:
+                throw default_exception("binary AST stream contains an invalid symbol tag");
+            }
+        }
+
+        ast * read_node_ref() {
+            unsigned id = read_u32();
+            if (id >= m_nodes.size())
+                throw default_exception("binary AST stream contains a forward node reference");
+            return m_nodes.get(id);
+        }
+
+        sort * read_sort_ref() {
+            ast * n = read_node_ref();
+            if (!is_sort(n))
+                throw default_exception("binary AST stream expects a sort reference");
+            return to_sort(n);
+        }
+
+        expr * read_expr_ref() {
+            ast * n = read_node_ref();
+            if (!is_expr(n))
+                throw default_exception("binary AST stream expects an expression reference");
+            return to_expr(n);
+        }
+
+        parameter read_param() {
+            switch (read_u8()) {
+            case PAR_INT:
+                return parameter(static_cast<int>(read_u32()));
+            case PAR_AST:
+                return parameter(read_node_ref());
+            case PAR_SYMBOL:
+                return parameter(read_sym());
+            case PAR_RATIONAL:
+                return parameter(rational(read_str().c_str()));
+            case PAR_DOUBLE: {
+                uint64_t bits = read_u32();
+                bits |= static_cast<uint64_t>(read_u32()) << 32;
+                double d;
+                memcpy(&d, &bits, sizeof(d));
+                return parameter(d);
+            }
+            case PAR_ZSTRING:
+                return parameter(zstring(read_str().c_str()));
+            default:
+                throw default_exception("binary AST stream contains an invalid parameter tag");
+            }
+        }
+
+        void read_params(vector<parameter> & ps) {
+            unsigned num = read_u32();
+            for (unsigned i = 0; i < num; i++)
+                ps.push_back(read_param());
+        }
+
+        ast * read_sort() {
+            bool has_family = read_u8() != 0;
+            if (has_family) {
+                family_id fid = m.mk_family_id(read_sym());
+                decl_kind k = static_cast<decl_kind>(read_u32());
+                vector<parameter> ps;
+                read_params(ps);
+                return m.mk_sort(fid, k, ps.size(), ps.data());
+            }
+            symbol name = read_sym();
+            vector<parameter> ps;
+            read_params(ps);
+            return m.mk_uninterpreted_sort(name, ps.size(), ps.data());
+        }
+
+        ast * read_func_decl() {
+            bool has_family = read_u8() != 0;
+            if (has_family) {
+                family_id fid = m.mk_family_id(read_sym());
+                decl_kind k = static_cast<decl_kind>(read_u32());
+                vector<parameter> ps;
+                read_params(ps);
+                unsigned arity = read_u32();
+                ptr_vector<sort> domain;
+                for (unsigned i = 0; i < arity; i++)
+                    domain.push_back(read_sort_ref());
+                return m.mk_func_decl(fid, k, ps.size(), ps.data(), arity, domain.data());
+            }
+            symbol name = read_sym();
+            unsigned arity = read_u32();
+            ptr_vector<sort> domain;
+            for (unsigned i = 0; i < arity; i++)
+                domain.push_back(read_sort_ref());
+            sort * range = read_sort_ref();
+            return m.mk_func_decl(name, arity, domain.data(), range);
+        }
+
+        ast * read_app() {
+            ast * d = read_node_ref();
+            if (!is_func_decl(d))
+                throw default_exception("binary AST stream expects a declaration reference");
+            unsigned num = read_u32();
+            ptr_vector<expr> args;
+            for (unsigned i = 0; i < num; i++)
+                args.push_back(read_expr_ref());
+            return m.mk_app(to_func_decl(d), num, args.data());
+        }
+
+        ast * read_var() {
+            unsigned idx = read_u32();
+            return m.mk_var(idx, read_sort_ref());
+        }
+
+        ast * read_quantifier() {
+            unsigned char k = read_u8();
+            if (k > lambda_k)
+                throw default_exception("binary AST stream contains an invalid quantifier kind");
+            unsigned num_decls = read_u32();
+            sbuffer<symbol> names;
+            ptr_vector<sort> sorts;
+            for (unsigned i = 0; i < num_decls; i++) {
+                names.push_back(read_sym());
+                sorts.push_back(read_sort_ref());
+            }
+            expr * body = read_expr_ref();
+            int weight = static_cast<int>(read_u32());
+            symbol qid = read_sym();
+            symbol skid = read_sym();
+            unsigned num_patterns = read_u32();
+            ptr_vector<expr> patterns;
+            for (unsigned i = 0; i < num_patterns; i++)
+                patterns.push_back(read_expr_ref());
+            unsigned num_no_patterns = read_u32();
+            ptr_vector<expr> no_patterns;
+            for (unsigned i = 0; i < num_no_patterns; i++)
+                no_patterns.push_back(read_expr_ref());
+            return m.mk_quantifier(static_cast<quantifier_kind>(k), num_decls, sorts.data(), names.data(), body,
+                                   weight, qid, skid,
+                                   num_patterns, patterns.data(), num_no_patterns, no_patterns.data());
+        }
+
+        void operator()(expr_ref_vector & roots) {
+            char magic[4];
+            m_in.read(magic, sizeof(magic));
+            if (m_in.gcount() != sizeof(magic) || memcmp(magic, BIN_MAGIC, sizeof(magic)) != 0)
+                throw default_exception("input is not a binary AST stream");
+            unsigned version = read_u32();
+            if (version != BIN_VERSION)
+                throw default_exception("unsupported binary AST format version");
+            for (;;) {
+                unsigned char tag = read_u8();
+                if (tag == TAG_END)
+                    break;
+                switch (tag) {
+                case TAG_SORT:
+                    m_nodes.push_back(read_sort());
+                    break;
+                case TAG_FUNC_DECL:
+                    m_nodes.push_back(read_func_decl());
+                    break;
+                case TAG_APP:
+                    m_nodes.push_back(read_app());
+                    break;
+                case TAG_VAR:
+                    m_nodes.push_back(read_var());
+                    break;
+                case TAG_QUANTIFIER:
+                    m_nodes.push_back(read_quantifier());
+                    break;
+                default:
+                    throw default_exception("binary AST stream contains an invalid node tag");
+                }
+            }
+            unsigned num = read_u32();
+            for (unsigned i = 0; i < num; i++)
+                roots.push_back(read_expr_ref());
+        }
+    };
+}
+
+void serialize_ast_dag(std::ostream & out, ast_manager & m, unsigned num, expr * const * roots) {
+    serializer s(out, m);
+    s(num, roots);
+}
+
+void deserialize_ast_dag(std::istream & in, ast_manager & m, expr_ref_vector & roots) {
+    deserializer d(in, m);
+    d(roots);
+}
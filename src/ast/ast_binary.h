@@ -0,0 +1,45 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    ast_binary.h
+
+Abstract:
+
+    Versioned binary serialization of AST DAGs.
+
+    The format stores node records in topological order with dense
+    ids assigned in write order, and interns symbols on first use.
+    Reading is a single linear pass that never re-hashes structure
+    that was already shared in the writer, so loading large goals is
+    considerably cheaper than re-parsing SMT-LIB2 text.
+
+    Sorts and declarations of builtin theories are keyed by family
+    name and decl kind, so streams are stable across processes.
+    Declarations carrying PARAM_EXTERNAL parameters and datatype
+    sorts (which require plugin-side registration) are not supported;
+    serialization raises an exception for them.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+--*/
+#pragma once
+
+#include "ast/ast.h"
+#include <iostream>
+
+/**
+   \brief Write the DAG rooted at the given expressions to \c out.
+   Throws default_exception on non-serializable parameters.
+*/
+void serialize_ast_dag(std::ostream & out, ast_manager & m, unsigned num, expr * const * roots);
+
+/**
+   \brief Read a DAG previously produced by serialize_ast_dag and
+   append the root expressions to \c roots.
+   Throws default_exception on malformed or incompatible input.
+*/
+void deserialize_ast_dag(std::istream & in, ast_manager & m, expr_ref_vector & roots);
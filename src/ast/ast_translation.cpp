@@ -45,6 +45,26 @@ void ast_translation::reset_cache() {
     m_cache.reset();
 }
 
+void ast_translation::compact_cache() {
+    // Evict entries whose source node is referenced only by the cache:
+    // such a node is dead for the client, and if an identical term is
+    // re-created later, translating it from scratch is the same cost as a
+    // lookup would have been. Entries whose source is still shared are
+    // kept, so repeated translations of overlapping terms only pay for
+    // the unseen delta. Eviction may drop source ref counts of surviving
+    // entries to one; those are collected by the next compaction.
+    ptr_vector<ast> stale;
+    for (auto & kv : m_cache)
+        if (kv.m_key->get_ref_count() == 1)
+            stale.push_back(kv.m_key);
+    for (ast * s : stale) {
+        ast * t = m_cache[s];
+        m_cache.erase(s);
+        m_from_manager.dec_ref(s);
+        m_to_manager.dec_ref(t);
+    }
+}
+
 void ast_translation::cache(ast * s, ast * t) {
     SASSERT(!m_cache.contains(s));
     if (s->get_ref_count() > 1) {
@@ -216,18 +236,24 @@ ast * ast_translation::process(ast const * _n) {
     
     ++m_num_process;
     if (m_num_process > (1 << 14)) {
-        reset_cache();
+        compact_cache();
         m_num_process = 0;
     }
+    // set on the paths that enter the loop right after visit() pushed a
+    // frame: visit() already checked the cache for that node, so the
+    // lookup at the loop head can be skipped. Frames reached any other
+    // way (in particular duplicates of shared nodes) still re-check,
+    // since their node may have been cached in the meantime.
+    bool just_pushed = true;
     if (!visit(const_cast<ast*>(_n))) {
         while (!m_frame_stack.empty()) {
         loop:
             ++m_loop_count;
             frame & fr = m_frame_stack.back();
             ast * n = fr.m_n;
-            ast * r;         
+            ast * r;
             TRACE(ast_translation, tout << mk_ll_pp(n, m_from_manager, false) << "\n";);
-            if (fr.m_idx == 0 && n->get_ref_count() > 1) {
+            if (fr.m_idx == 0 && !just_pushed && n->get_ref_count() > 1) {
                 if (m_cache.find(n, r)) {
                     SASSERT(m_result_stack.size() == fr.m_rpos);
                     m_result_stack.push_back(r);
@@ -241,12 +267,15 @@ ast * ast_translation::process(ast const * _n) {
                     m_miss_count++;
                 }
             }
+            just_pushed = false;
             switch (n->get_kind()) {
             case AST_VAR: {
                 if (fr.m_idx == 0) {
                     fr.m_idx = 1;
-                    if (!visit(to_var(n)->get_sort()))
+                    if (!visit(to_var(n)->get_sort())) {
+                        just_pushed = true;
                         goto loop;
+                    }
                 }
                 sort * new_s  = to_sort(m_result_stack.back());
                 var * new_var = m_to_manager.mk_var(to_var(n)->get_idx(), new_s);
@@ -259,15 +288,19 @@ ast * ast_translation::process(ast const * _n) {
             case AST_APP: {
                 if (fr.m_idx == 0) {
                     fr.m_idx = 1;
-                    if (!visit(to_app(n)->get_decl()))
+                    if (!visit(to_app(n)->get_decl())) {
+                        just_pushed = true;
                         goto loop;
+                    }
                 }
                 unsigned num = to_app(n)->get_num_args();
                 while (fr.m_idx <= num) {
                     expr * arg = to_app(n)->get_arg(fr.m_idx - 1);
                     fr.m_idx++;
-                    if (!visit(arg)) 
+                    if (!visit(arg)) {
+                        just_pushed = true;
                         goto loop;
+                    }
                 }
                 func_decl * new_f   = to_func_decl(m_result_stack[fr.m_rpos]);
                 expr ** new_args    = reinterpret_cast<expr **>(m_result_stack.data() + fr.m_rpos + 1);
@@ -288,8 +321,10 @@ ast * ast_translation::process(ast const * _n) {
                     else
                         child = to_quantifier(n)->get_child(fr.m_idx - num_decls);
                     fr.m_idx++;
-                    if (!visit(child))
+                    if (!visit(child)) {
+                        just_pushed = true;
                         goto loop;
+                    }
                 }
                 symbol const * dnames = to_quantifier(n)->get_decl_names();
                 sort **  dsorts       = reinterpret_cast<sort**>(m_result_stack.data() + fr.m_rpos);
@@ -320,8 +355,10 @@ ast * ast_translation::process(ast const * _n) {
                 while (fr.m_idx < num) {
                     ast * c = m_extra_children_stack[fr.m_cpos + fr.m_idx];
                     fr.m_idx++;
-                    if (!visit(c))
+                    if (!visit(c)) {
+                        just_pushed = true;
                         goto loop;
+                    }
                 }
                 mk_sort(to_sort(n), fr);
                 break;
@@ -340,8 +377,10 @@ ast * ast_translation::process(ast const * _n) {
                     else
                         c = to_func_decl(n)->get_range();
                     fr.m_idx++;
-                    if (!visit(c))
+                    if (!visit(c)) {
+                        just_pushed = true;
                         goto loop;
+                    }
                 }
                 mk_func_decl(to_func_decl(n), fr);
                 break;
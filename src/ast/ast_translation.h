@@ -94,6 +94,7 @@ public:
     }
 
     void reset_cache();
+    void compact_cache();
     void cleanup();
     
     unsigned loop_count() const { return m_loop_count; }
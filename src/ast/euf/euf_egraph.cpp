@@ -533,8 +533,11 @@ namespace euf {
             set_conflict(n1, n2, j);
             return;
         }
-        if (!r2->interpreted() && 
-             (r1->class_size() > r2->class_size() || r1->interpreted() || r1->value() != l_undef)) {
+        // the cost of eliminating r1 as root is one root update per class member
+        // plus one congruence table remove/reinsert per parent; pick the cheaper side.
+        if (!r2->interpreted() &&
+             (r1->class_size() + r1->num_parents() > r2->class_size() + r2->num_parents() ||
+              r1->interpreted() || r1->value() != l_undef)) {
             std::swap(r1, r2);
             std::swap(n1, n2);
         }
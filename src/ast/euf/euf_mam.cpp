@@ -676,10 +676,10 @@ namespace euf {
         }
 
     public:
-        code_tree_manager(label_hasher & h, euf::mam_solver& ctx):
+        code_tree_manager(label_hasher & h, euf::mam_solver& ctx, region & r):
             ctx(ctx),
             m_lbl_hasher(h),
-            m_region(ctx.get_region()) {
+            m_region(r) {
         }
 
         code_tree * mk_code_tree(app* p, unsigned short num_args, bool filter_candidates) {
@@ -1282,6 +1282,13 @@ namespace euf {
                 m_ct_manager.set_next(instr, new_next);
         }
 
+        void insert_new_lbl_hash(filter * instr, unsigned h) {
+            if (m_is_tmp_tree)
+                instr->m_lbl_set.insert(h);
+            else
+                m_ct_manager.insert_new_lbl_hash(instr, h);
+        }
+
         /*
           The nodes in the bottom of the code-tree can have a lot of children in big examples.
           Example:
@@ -1671,7 +1678,7 @@ namespace euf {
                             set_check_mark(reg, CHECK_SET);
                             approx_set const & s = flt->m_lbl_set;
                             if (s.size() > 1) {
-                                m_ct_manager.insert_new_lbl_hash(flt, h);
+                                insert_new_lbl_hash(flt, h);
                                 m_compatible.push_back(curr);
                             }
                             else {
@@ -3191,6 +3198,13 @@ namespace euf {
         interpreter                 m_interpreter;
         code_tree_map               m_trees;
 
+        // One-shot trees compiled in propagate_new_patterns are executed and
+        // deallocated within the same call. Their instructions are kept out of
+        // the solver region, which is only reclaimed on backtracking, and are
+        // recycled here after each batch instead.
+        region                      m_tmp_code_region;
+        code_tree_manager           m_tmp_ct_manager;
+        compiler                    m_tmp_compiler;
         ptr_vector<code_tree>       m_tmp_trees;
         ptr_vector<func_decl>       m_tmp_trees_to_delete;
         ptr_vector<code_tree>       m_to_match;
@@ -3840,11 +3854,11 @@ namespace euf {
                     unsigned lbl_id = lbl->get_small_id();
                     m_tmp_trees.reserve(lbl_id+1, 0);
                     if (m_tmp_trees[lbl_id] == 0) {
-                        m_tmp_trees[lbl_id] = m_compiler.mk_tree(qa, mp, 0, false);
+                        m_tmp_trees[lbl_id] = m_tmp_compiler.mk_tree(qa, mp, 0, false);
                         m_tmp_trees_to_delete.push_back(lbl);
                     }
                     else {
-                        m_compiler.insert(m_tmp_trees[lbl_id], qa, mp, 0, true);
+                        m_tmp_compiler.insert(m_tmp_trees[lbl_id], qa, mp, 0, true);
                     }
                 }
             }
@@ -3864,6 +3878,7 @@ namespace euf {
                 m_tmp_trees[lbl_id] = nullptr;
                 dealloc(tmp_tree);
             }
+            m_tmp_code_region.reset();
         }
 
     public:
@@ -3873,10 +3888,12 @@ namespace euf {
             m_ematch(ematch),
             m(ctx.get_manager()),
             m_use_filters(use_filters),
-            m_ct_manager(m_lbl_hasher, ctx),
+            m_ct_manager(m_lbl_hasher, ctx, ctx.get_region()),
             m_compiler(m_egraph, m_ct_manager, m_lbl_hasher, use_filters),
             m_interpreter(ctx, *this, use_filters),
             m_trees(m, m_compiler, ctx),
+            m_tmp_ct_manager(m_lbl_hasher, ctx, m_tmp_code_region),
+            m_tmp_compiler(m_egraph, m_tmp_ct_manager, m_lbl_hasher, use_filters),
             m_region(ctx.get_region()) {
             DEBUG_CODE(m_trees.set_egraph(&m_egraph););
             DEBUG_CODE(m_check_missing_instances = false;);
@@ -19,9 +19,40 @@ Revision History:
 
 #include "ast/macros/macro_finder.h"
 #include "ast/occurs.h"
+#include "ast/for_each_expr.h"
 #include "ast/ast_pp.h"
 #include "ast/ast_ll_pp.h"
 
+namespace {
+    struct found {};
+
+    struct head_proc {
+        func_decl_set const & m_heads;
+        head_proc(func_decl_set const & heads):m_heads(heads) {}
+        void operator()(var const * n) {}
+        void operator()(app const * n) { if (m_heads.contains(n->get_decl())) throw found(); }
+        void operator()(quantifier const * n) {}
+    };
+}
+
+/**
+   \brief Return true if \c n contains an application of one of the given macro heads.
+   A formula that was left untouched by a previous round of expand_macros can only
+   expand differently if it mentions a macro discovered after it was processed.
+*/
+static bool contains_macro_head(func_decl_set const & heads, expr * n) {
+    if (heads.empty())
+        return false;
+    head_proc p(heads);
+    try {
+        quick_for_each_expr(p, n);
+    }
+    catch (const found &) {
+        return true;
+    }
+    return false;
+}
+
 bool macro_finder::is_macro(expr * n, app_ref & head, expr_ref & def) {
     if (!is_forall(n))
         return false;
@@ -269,17 +300,36 @@ macro_finder::macro_finder(ast_manager & m, macro_manager & mm):
     m_autil(m) {
 }
 
-bool macro_finder::expand_macros(expr_ref_vector const& exprs, proof_ref_vector const& prs, expr_dependency_ref_vector const& deps,  expr_ref_vector & new_exprs, proof_ref_vector & new_prs, expr_dependency_ref_vector & new_deps) {
+void macro_finder::collect_new_heads(unsigned old_num_macros, func_decl_set & new_heads) {
+    new_heads.reset();
+    for (unsigned i = old_num_macros; i < m_macro_manager.get_num_macros(); i++)
+        new_heads.insert(m_macro_manager.get_macro_func_decl(i));
+}
+
+bool macro_finder::expand_macros(expr_ref_vector const& exprs, proof_ref_vector const& prs, expr_dependency_ref_vector const& deps,  expr_ref_vector & new_exprs, proof_ref_vector & new_prs, expr_dependency_ref_vector & new_deps,
+                                 func_decl_set const * new_heads, bool_vector & dirty) {
     TRACE(macro_finder, tout << "starting expand_macros:\n";
           m_macro_manager.display(tout););
     bool found_new_macro = false;
     unsigned num = exprs.size();
     bool deps_valid = deps.size() == exprs.size();
     SASSERT(deps_valid || deps.empty());
+    bool_vector new_dirty;
     for (unsigned i = 0; i < num; i++) {
         expr * n       = exprs[i];
         proof * pr     = m.proofs_enabled() ? prs[i] : nullptr;
         expr_dependency * dep = deps.get(i, nullptr);
+        // In rounds after the first, a formula that was copied through unchanged can
+        // only behave differently if it mentions a macro head found in the meantime.
+        if (new_heads && i < dirty.size() && !dirty[i] && !contains_macro_head(*new_heads, n)) {
+            new_exprs.push_back(n);
+            if (m.proofs_enabled())
+                new_prs.push_back(pr);
+            if (deps_valid)
+                new_deps.push_back(dep);
+            new_dirty.push_back(false);
+            continue;
+        }
         expr_ref new_n(m), def(m);
         proof_ref new_pr(m);
         expr_dependency_ref new_dep(m);
@@ -304,11 +354,16 @@ bool macro_finder::expand_macros(expr_ref_vector const& exprs, proof_ref_vector
                 new_prs.push_back(new_pr);
             if (deps_valid)
                 new_deps.push_back(new_dep);
+            new_dirty.push_back(false);
         }
+        // formulas produced by splitting arith/pseudo-predicate macros have not
+        // been macro-checked yet.
+        new_dirty.resize(new_exprs.size(), true);
         SASSERT(exprs.size() != deps.size() || new_exprs.size() == new_deps.size());
         // SASSERT(!m.proofs_enabled() || new_exprs.size() == new_prs.size());
 
     }
+    dirty.swap(new_dirty);
     return found_new_macro;
 }
 
@@ -318,8 +373,13 @@ void macro_finder::operator()(expr_ref_vector const& exprs, proof_ref_vector con
     proof_ref_vector  _new_prs(m);
     expr_dependency_ref_vector _new_deps(m);
     unsigned num = exprs.size();
-    if (expand_macros(exprs, prs, deps, _new_exprs, _new_prs, _new_deps)) {
+    bool_vector dirty;
+    func_decl_set new_heads;
+    unsigned num_macros = m_macro_manager.get_num_macros();
+    if (expand_macros(exprs, prs, deps, _new_exprs, _new_prs, _new_deps, nullptr, dirty)) {
         for (unsigned i = 0; i < num; ++i) {
+            collect_new_heads(num_macros, new_heads);
+            num_macros = m_macro_manager.get_num_macros();
             expr_ref_vector  old_exprs(m);
             proof_ref_vector old_prs(m);
             expr_dependency_ref_vector old_deps(m);
@@ -330,7 +390,7 @@ void macro_finder::operator()(expr_ref_vector const& exprs, proof_ref_vector con
             SASSERT(_new_prs.empty());
             SASSERT(_new_deps.empty());
             if (!expand_macros(old_exprs, old_prs, old_deps,
-                               _new_exprs, _new_prs, _new_deps))
+                               _new_exprs, _new_prs, _new_deps, &new_heads, dirty))
                 break;
         }
     }
@@ -341,13 +401,20 @@ void macro_finder::operator()(expr_ref_vector const& exprs, proof_ref_vector con
 
 
 
-bool macro_finder::expand_macros(unsigned num, justified_expr const * fmls, vector<justified_expr>& new_fmls) {
+bool macro_finder::expand_macros(unsigned num, justified_expr const * fmls, vector<justified_expr>& new_fmls,
+                                 func_decl_set const * new_heads, bool_vector & dirty) {
     TRACE(macro_finder, tout << "starting expand_macros:\n";
           m_macro_manager.display(tout););
     bool found_new_macro = false;
+    bool_vector new_dirty;
     for (unsigned i = 0; i < num; i++) {
         expr * n       = fmls[i].fml();
         proof * pr     = m.proofs_enabled() ? fmls[i].pr() : nullptr;
+        if (new_heads && i < dirty.size() && !dirty[i] && !contains_macro_head(*new_heads, n)) {
+            new_fmls.push_back(fmls[i]);
+            new_dirty.push_back(false);
+            continue;
+        }
         expr_ref new_n(m), def(m);
         proof_ref new_pr(m);
         expr_dependency_ref new_dep(m);
@@ -368,8 +435,11 @@ bool macro_finder::expand_macros(unsigned num, justified_expr const * fmls, vect
         }
         else {
             new_fmls.push_back(justified_expr(m, new_n, new_pr));
+            new_dirty.push_back(false);
         }
+        new_dirty.resize(new_fmls.size(), true);
     }
+    dirty.swap(new_dirty);
     return found_new_macro;
 }
 
@@ -386,12 +456,17 @@ void macro_finder::operator()(unsigned n, justified_expr const* fmls, vector<jus
     m_macro_manager.unsafe_macros().reset();
     TRACE(macro_finder, tout << "processing macros...\n";);
     vector<justified_expr> _new_fmls;
-    if (expand_macros(n, fmls, _new_fmls)) {
+    bool_vector dirty;
+    func_decl_set new_heads;
+    unsigned num_macros = m_macro_manager.get_num_macros();
+    if (expand_macros(n, fmls, _new_fmls, nullptr, dirty)) {
         while (true) {
+            collect_new_heads(num_macros, new_heads);
+            num_macros = m_macro_manager.get_num_macros();
             vector<justified_expr> old_fmls;
             _new_fmls.swap(old_fmls);
             SASSERT(_new_fmls.empty());
-            if (!expand_macros(old_fmls.size(), old_fmls.data(), _new_fmls))
+            if (!expand_macros(old_fmls.size(), old_fmls.data(), _new_fmls, &new_heads, dirty))
                 break;
         }
     }
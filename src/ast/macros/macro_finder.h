@@ -30,9 +30,12 @@ class macro_finder {
     macro_manager &             m_macro_manager;
     macro_util &                m_util;
     arith_util                  m_autil;
-    bool expand_macros(expr_ref_vector const& exprs, proof_ref_vector const& prs, expr_dependency_ref_vector const & deps, 
-                       expr_ref_vector & new_exprs, proof_ref_vector & new_prs, expr_dependency_ref_vector& new_deps);
-    bool expand_macros(unsigned n, justified_expr const * fmls, vector<justified_expr>& new_fmls);
+    bool expand_macros(expr_ref_vector const& exprs, proof_ref_vector const& prs, expr_dependency_ref_vector const & deps,
+                       expr_ref_vector & new_exprs, proof_ref_vector & new_prs, expr_dependency_ref_vector& new_deps,
+                       func_decl_set const * new_heads, bool_vector & dirty);
+    bool expand_macros(unsigned n, justified_expr const * fmls, vector<justified_expr>& new_fmls,
+                       func_decl_set const * new_heads, bool_vector & dirty);
+    void collect_new_heads(unsigned old_num_macros, func_decl_set & new_heads);
     bool is_arith_macro(expr * n, proof * pr, expr_ref_vector & new_exprs, proof_ref_vector & new_prs);
     bool is_arith_macro(expr * n, proof * pr, vector<justified_expr>& new_fmls);
     bool is_arith_macro(expr * n, proof * pr, bool deps_valid, expr_dependency * dep, expr_ref_vector & new_exprs, proof_ref_vector & new_prs, expr_dependency_ref_vector & new_deps);
@@ -254,8 +254,10 @@ struct nnf::imp {
     // configuration ----------------
     nnf_mode               m_mode;
     bool                   m_ignore_labels;
+    bool                   m_sharing;
     // ------------------------------
 
+    defined_names &        m_defined_names;
     name_exprs *           m_name_nested_formulas;
     name_exprs *           m_name_quant;
 
@@ -268,7 +270,8 @@ struct nnf::imp {
         m_todo_defs(m),
         m_todo_proofs(m),
         m_result_pr_stack(m),
-        m_skolemizer(m) {
+        m_skolemizer(m),
+        m_defined_names(n) {
         updt_params(p);
         for (unsigned i = 0; i < 4; i++) {
             if (proofs_enabled())
@@ -304,6 +307,7 @@ struct nnf::imp {
         TRACE(nnf, tout << "nnf-mode: " << m_mode << " " << mode_sym << "\n" << _p << "\n";);
 
         m_ignore_labels    = p.ignore_labels();
+        m_sharing          = p.sharing();
         m_max_memory       = megabytes_to_bytes(p.max_memory());
         m_skolemizer.set_sk_hack(p.sk_hack());
     }
@@ -535,8 +539,48 @@ struct nnf::imp {
         return true;
     }
 
+    /**
+       \brief ite and iff/xor translate an argument under both polarities, so nesting
+       these connectives can copy a shared subtree once per polarity context. When
+       nnf.sharing is enabled, an argument that would actually be rewritten (and not
+       just copied verbatim by visit) is named once using defined_names, and the fresh
+       name is used both positively and negatively. The definition is added to
+       m_todo_defs and converted into NNF only once. The results for the argument
+       (positive first, then negative) are pushed on the result stack.
+    */
+    bool apply_sharing(expr * arg) {
+        if (!m_sharing)
+            return false;
+        if (!is_quantifier(arg) && (!is_app(arg) || to_app(arg)->get_num_args() == 0))
+            return false; // variables and constants are cheap to duplicate
+        if ((m_mode == NNF_SKOLEM || (m_mode == NNF_QUANT && !m_frame_stack.back().m_in_q)) &&
+            !has_quantifiers(arg) && !has_labels(arg))
+            return false; // visit() copies these verbatim, nothing is duplicated
+        expr_ref  new_def(m);
+        proof_ref new_def_pr(m);
+        app_ref   n2(m);
+        proof_ref pr2(m);
+        if (m_defined_names.mk_name(arg, new_def, new_def_pr, n2, pr2)) {
+            m_todo_defs.push_back(new_def);
+            if (proofs_enabled())
+                m_todo_proofs.push_back(new_def_pr);
+        }
+        expr_ref neg(mk_not(m, n2), m);
+        m_result_stack.push_back(n2);
+        m_result_stack.push_back(neg);
+        if (proofs_enabled()) {
+            m_result_pr_stack.push_back(pr2);
+            proof * prs[1] = { pr2 };
+            m_result_pr_stack.push_back(m.mk_oeq_congruence(m.mk_not(arg), static_cast<app*>(neg.get()), 1, prs));
+            SASSERT(m_result_stack.size() == m_result_pr_stack.size());
+        }
+        return true;
+    }
+
     bool process_ite(app * t, frame & fr) {
         SASSERT(t->get_num_args() == 3);
+        if (fr.m_i == 0 && apply_sharing(t->get_arg(0)))
+            fr.m_i = 2;
         switch (fr.m_i) {
         case 0:
             fr.m_i = 1;
@@ -581,6 +625,10 @@ struct nnf::imp {
     bool process_iff_xor(app * t, frame & fr) {
         if (t->get_num_args() != 2)
             throw default_exception("apply simplification before nnf to normalize arguments to xor/=");
+        if (fr.m_i == 0 && apply_sharing(t->get_arg(0)))
+            fr.m_i = 2;
+        if (fr.m_i == 2 && apply_sharing(t->get_arg(1)))
+            fr.m_i = 4;
         switch (fr.m_i) {
         case 0:
             fr.m_i = 1;
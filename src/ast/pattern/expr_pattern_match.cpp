@@ -34,8 +34,11 @@ Notes:
 #include "ast/for_each_ast.h"
 #include "ast/ast_ll_pp.h"
 #include "ast/ast_pp.h"
+#include "ast/ast_translation.h"
+#include "ast/reg_decl_plugins.h"
 #include "cmd_context/cmd_context.h"
 #include "parsers/smt2/smt2parser.h"
+#include "util/mutex.h"
 
 expr_pattern_match::expr_pattern_match(ast_manager & manager):
     m_manager(manager), m_precompiled(manager) {        
@@ -394,22 +397,50 @@ expr_pattern_match::is_var(func_decl* d) {
     return s && *s == '?';
 }
 
-void 
+// The pattern database is parsed once per process into a private manager;
+// each expr_pattern_match then translates the parsed entries into its own
+// manager, which is much cheaper than re-running the smt2 parser for every
+// solver that performs pattern inference.
+namespace {
+    struct pattern_database {
+        ast_manager     m;
+        expr_ref_vector exprs;
+        pattern_database(): exprs(m) {}
+    };
+}
+
+static pattern_database * g_pattern_db = nullptr;
+static mutex              g_pattern_db_mux;
+
+void finalize_pattern_database() {
+    dealloc(g_pattern_db);
+    g_pattern_db = nullptr;
+}
+
+void
 expr_pattern_match::initialize(char const * spec_string) {
     if (!m_instrs.empty()) {
         return;
     }
     m_instrs.push_back(instr(BACKTRACK));
 
-    std::istringstream is(spec_string);
-    cmd_context      ctx(true, &m_manager);	
-    bool ps = ctx.print_success_enabled();
-    ctx.set_print_success(false);
-    VERIFY(parse_smt2_commands(ctx, is));
-    ctx.set_print_success(ps);
+    lock_guard lock(g_pattern_db_mux);
+    if (!g_pattern_db) {
+        g_pattern_db = alloc(pattern_database);
+        std::istringstream is(spec_string);
+        reg_decl_plugins(g_pattern_db->m);
+        cmd_context ctx(false, &g_pattern_db->m);
+        bool ps = ctx.print_success_enabled();
+        ctx.set_print_success(false);
+        VERIFY(parse_smt2_commands(ctx, is));
+        ctx.set_print_success(ps);
+        for (expr * e : ctx.assertions())
+            g_pattern_db->exprs.push_back(e);
+    }
 
-    for (expr * e : ctx.assertions()) {
-        compile(e);
+    ast_translation translate(g_pattern_db->m, m_manager);
+    for (expr * e : g_pattern_db->exprs) {
+        compile(translate(e));
     }
 }
 
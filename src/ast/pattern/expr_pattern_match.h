@@ -22,6 +22,11 @@ Notes:
 #include "ast/ast.h"
 #include "util/map.h"
 
+void finalize_pattern_database();
+/*
+  ADD_FINALIZER('finalize_pattern_database();')
+*/
+
 class expr_pattern_match {
 
     enum instr_kind {
@@ -20,7 +20,11 @@ Revision History:
 #include "ast/pp_params.hpp"
 using namespace format_ns;
 
-static std::pair<unsigned, bool> space_upto_line_break(ast_manager & m, format * f) {
+// The measurement is cut off once it exceeds the given bound: the only
+// caller is fits, which just compares the result against the available
+// space, so scanning a large subtree past the bound is wasted work and
+// makes layout quadratic on deeply nested single-line formats.
+static std::pair<unsigned, bool> space_upto_line_break(ast_manager & m, format * f, unsigned bound) {
     unsigned r;
     SASSERT(f->get_family_id() == fm(m).get_family_id("format"));
     decl_kind k = f->get_decl_kind();
@@ -30,18 +34,20 @@ static std::pair<unsigned, bool> space_upto_line_break(ast_manager & m, format *
         return std::make_pair(len, false);
     }
     case OP_CHOICE:
-        return space_upto_line_break(m, to_app(f->get_arg(0)));
-    case OP_COMPOSE: 
+        return space_upto_line_break(m, to_app(f->get_arg(0)), bound);
+    case OP_COMPOSE:
         r = 0;
         for (unsigned i = 0; i < f->get_num_args(); i++) {
-            std::pair<unsigned, bool> pair = space_upto_line_break(m, to_app(f->get_arg(i)));
+            if (r > bound)
+                return std::make_pair(r, true);
+            std::pair<unsigned, bool> pair = space_upto_line_break(m, to_app(f->get_arg(i)), bound - r);
             r += pair.first;
             if (pair.second)
-                return std::make_pair(r, true); 
+                return std::make_pair(r, true);
         }
         return std::make_pair(r, false);
     case OP_INDENT:
-        return space_upto_line_break(m, to_app(f->get_arg(0)));
+        return space_upto_line_break(m, to_app(f->get_arg(0)), bound);
     case OP_LINE_BREAK:
     case OP_LINE_BREAK_EXT:
         return std::make_pair(0, true);
@@ -51,7 +57,7 @@ static std::pair<unsigned, bool> space_upto_line_break(ast_manager & m, format *
 }
 
 inline bool fits(ast_manager & m, format * f, unsigned space_left) {
-    unsigned s = space_upto_line_break(m, f).first;
+    unsigned s = space_upto_line_break(m, f, space_left).first;
     TRACE(fits, tout << "s: " << s << " space_left " << space_left << "\n";);
     return s <= space_left;
 }
@@ -237,19 +237,17 @@ void bit_blaster_tpl<Cfg>::mk_multiplier(unsigned sz, expr * const * a_bits, exp
        FA denotes a full-adder.
     */
 
+    expr_ref i1(m()), i2(m()), i3(m()), prev_out(m());
     for (unsigned i = 1; i < sz; i++) {
         checkpoint();
         couts.reset();
-        expr_ref i1(m()), i2(m());
         mk_and(a_bits[0], b_bits[i], i1);
         mk_and(a_bits[1], b_bits[i - 1], i2);
         if (i < sz - 1) {
             mk_half_adder(i1, i2, out, cout);
             couts.push_back(cout);
             for (unsigned j = 2; j <= i; j++) {
-                expr_ref prev_out(m());
                 prev_out = out;
-                expr_ref i3(m());
                 mk_and(a_bits[j], b_bits[i - j], i3);
                 mk_full_adder(i3, prev_out, cins.get(j - 2), out, cout);
                 couts.push_back(cout);
@@ -261,7 +259,6 @@ void bit_blaster_tpl<Cfg>::mk_multiplier(unsigned sz, expr * const * a_bits, exp
             // last step --> I don't need to generate/store couts.
             mk_xor(i1, i2, out);
             for (unsigned j = 2; j <= i; j++) {
-                expr_ref i3(m());
                 mk_and(a_bits[j], b_bits[i - j], i3);
                 mk_xor3(i3, out, cins.get(j - 2), out);
             }
@@ -585,6 +585,14 @@ void bv2int_translator::translate_basic(app* e) {
 }
 
 bool bv2int_translator::is_bounded(expr* x, rational const& N) {
+    rational v;
+    expr* c = nullptr, * t = nullptr, * e = nullptr;
+    if (a.is_numeral(x, v))
+        return 0 <= v && v < N;
+    if (m.is_ite(x, c, t, e))
+        return is_bounded(t, N) && is_bounded(e, N);
+    if (a.is_mod(x, t, e) && a.is_numeral(e, v) && 0 < v && v <= N)
+        return true;
     return any_of(m_vars, [&](expr* v) {
         return is_translated(v) && translated(v) == x && bv_size(v) <= N;
         });
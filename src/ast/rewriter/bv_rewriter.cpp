@@ -774,82 +774,92 @@ br_status bv_rewriter::mk_extract(unsigned high, unsigned low, expr * arg, expr_
         return BR_DONE;
     }
 
-    // (extract[high:low] (extract[high2:low2] x)) == (extract[high+low2 : low+low2] x)
-    if (m_util.is_extract(arg)) {
-        unsigned low2 = m_util.get_extract_low(arg);
-        result = m_mk_extract(high + low2, low + low2, to_app(arg)->get_arg(0));
-        return BR_DONE;
-    }
-
-    // (extract (concat ....)) --> (concat (extract ...) ... (extract ...) )
-    if (m_util.is_concat(arg)) {
-        unsigned num  = to_app(arg)->get_num_args();
-        unsigned idx  = sz;
-        for (unsigned i = 0; i < num; i++) {
-            expr * curr      = to_app(arg)->get_arg(i);
-            unsigned curr_sz = get_bv_size(curr);
-            idx -= curr_sz;
-            if (idx > high)
-                continue;
-            // found first argument
-            if (idx <= low) {
-                // result is a fragment of this argument
-                if (low == idx && high - idx == curr_sz - 1) {
-                    result = curr;
-                    return BR_DONE;
-                }
-                else {
-                    result = m_mk_extract(high - idx, low - idx, curr);
-                    return BR_REWRITE1;
-                }
-            }
-            else {
-                // look for remaining arguments
-                ptr_buffer<expr> new_args;
-                bool used_extract = false;
-                if (high - idx == curr_sz - 1) {
-                    new_args.push_back(curr);
+    // Dispatch once on the bv opcode instead of probing is_app_of for each
+    // candidate pattern; mk_extract is on the critical path of concat/extract chains.
+    if (is_app(arg) && to_app(arg)->get_family_id() == get_fid()) {
+        switch (to_app(arg)->get_decl()->get_decl_kind()) {
+        case OP_EXTRACT: {
+            // (extract[high:low] (extract[high2:low2] x)) == (extract[high+low2 : low+low2] x)
+            unsigned low2 = m_util.get_extract_low(arg);
+            result = m_mk_extract(high + low2, low + low2, to_app(arg)->get_arg(0));
+            return BR_DONE;
+        }
+        case OP_CONCAT: {
+            // (extract (concat ....)) --> (concat (extract ...) ... (extract ...) )
+            unsigned num  = to_app(arg)->get_num_args();
+            unsigned idx  = sz;
+            for (unsigned i = 0; i < num; i++) {
+                expr * curr      = to_app(arg)->get_arg(i);
+                unsigned curr_sz = get_bv_size(curr);
+                idx -= curr_sz;
+                if (idx > high)
+                    continue;
+                // found first argument
+                if (idx <= low) {
+                    // result is a fragment of this argument
+                    if (low == idx && high - idx == curr_sz - 1) {
+                        result = curr;
+                        return BR_DONE;
+                    }
+                    else {
+                        result = m_mk_extract(high - idx, low - idx, curr);
+                        return BR_REWRITE1;
+                    }
                 }
                 else {
-                    used_extract = true;
-                    new_args.push_back(m_mk_extract(high - idx, 0, curr));
-                }
-                for (unsigned j = i + 1; j < num; j++) {
-                    curr = to_app(arg)->get_arg(j);
-                    unsigned curr_sz = get_bv_size(curr);
-                    idx -= curr_sz;
-                    if (idx > low) {
+                    // look for remaining arguments
+                    ptr_buffer<expr> new_args;
+                    bool used_extract = false;
+                    if (high - idx == curr_sz - 1) {
                         new_args.push_back(curr);
-                        continue;
                     }
-                    if (idx == low) {
-                        new_args.push_back(curr);
+                    else {
+                        used_extract = true;
+                        new_args.push_back(m_mk_extract(high - idx, 0, curr));
+                    }
+                    for (unsigned j = i + 1; j < num; j++) {
+                        curr = to_app(arg)->get_arg(j);
+                        unsigned curr_sz = get_bv_size(curr);
+                        idx -= curr_sz;
+                        if (idx > low) {
+                            new_args.push_back(curr);
+                            continue;
+                        }
+                        if (idx == low) {
+                            new_args.push_back(curr);
+                            result = m_util.mk_concat(new_args.size(), new_args.data());
+                            return used_extract ? BR_REWRITE2 : BR_DONE;
+                        }
+                        new_args.push_back(m_mk_extract(curr_sz - 1, low - idx, curr));
                         result = m_util.mk_concat(new_args.size(), new_args.data());
-                        return used_extract ? BR_REWRITE2 : BR_DONE;
+                        return BR_REWRITE2;
                     }
-                    new_args.push_back(m_mk_extract(curr_sz - 1, low - idx, curr));
-                    result = m_util.mk_concat(new_args.size(), new_args.data());
-                    return BR_REWRITE2;
+                    UNREACHABLE();
                 }
-                UNREACHABLE();
             }
+            UNREACHABLE();
+            break;
         }
-        UNREACHABLE();
-    }
-
-    if (m_util.is_bv_not(arg) ||
-        m_util.is_bv_or(arg)  ||
-        m_util.is_bv_xor(arg) ||
-        (low == 0 && (m_util.is_bv_add(arg) ||
-                      m_util.is_bv_mul(arg)))) {
-        ptr_buffer<expr> new_args;
-        unsigned num = to_app(arg)->get_num_args();
-        for (unsigned i = 0; i < num; i++) {
-            expr * curr = to_app(arg)->get_arg(i);
-            new_args.push_back(m_mk_extract(high, low, curr));
+        case OP_BADD:
+        case OP_BMUL:
+            if (low != 0)
+                break;
+            Z3_fallthrough;
+        case OP_BNOT:
+        case OP_BOR:
+        case OP_BXOR: {
+            ptr_buffer<expr> new_args;
+            unsigned num = to_app(arg)->get_num_args();
+            for (unsigned i = 0; i < num; i++) {
+                expr * curr = to_app(arg)->get_arg(i);
+                new_args.push_back(m_mk_extract(high, low, curr));
+            }
+            result = m.mk_app(get_fid(), to_app(arg)->get_decl()->get_decl_kind(), new_args.size(), new_args.data());
+            return BR_REWRITE2;
+        }
+        default:
+            break;
         }
-        result = m.mk_app(get_fid(), to_app(arg)->get_decl()->get_decl_kind(), new_args.size(), new_args.data());
-        return BR_REWRITE2;
     }
 
     if (m_extract_prop && (high >= low)) {
@@ -1650,7 +1660,8 @@ br_status bv_rewriter::mk_concat(unsigned num_args, expr * const * args, expr_re
             prev = new_args.back();
             eq_args &= prev == arg;
         }
-        if (is_numeral(arg, v1, sz1) && prev != nullptr && is_numeral(prev, v2, sz2)) {
+        // check that prev is a numeral before unpacking the rational value of arg
+        if (prev != nullptr && m_util.is_numeral(prev) && is_numeral(arg, v1, sz1) && is_numeral(prev, v2, sz2)) {
             v2  *= rational::power_of_two(sz1);
             v2  += v1;
             new_args.pop_back();
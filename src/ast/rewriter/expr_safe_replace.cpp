@@ -27,7 +27,7 @@ void expr_safe_replace::insert(expr* src, expr* dst) {
     SASSERT(src->get_sort() == dst->get_sort());
     m_src.push_back(src);
     m_dst.push_back(dst);
-    m_cache.clear();
+    m_cache.reset();
 }
 
 void expr_safe_replace::operator()(expr_ref_vector& es) {
@@ -47,22 +47,21 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
     }
 
     if (m_cache.empty()) {
-        for (unsigned i = 0, e = m_src.size(); i < e; ++i) 
-            m_cache.emplace(m_src.get(i), m_dst.get(i));
+        for (unsigned i = 0, e = m_src.size(); i < e; ++i)
+            cache_result(m_src.get(i), m_dst.get(i));
     }
-    
+
     m_todo.push_back(e);
     expr* a, *b;
 
     m_refs.push_back(e);
     while (!m_todo.empty()) {
         a = m_todo.back();
-        auto &cached = m_cache[a];
-        if (cached) {
+        if (get_cached(a)) {
             m_todo.pop_back();
         }
         else if (is_var(a)) {
-            cached = a;
+            cache_result(a, a);
             m_todo.pop_back();
         }
         else if (is_app(a)) {
@@ -71,7 +70,7 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
             bool arg_differs = false, has_all_args = true;
             for (expr* arg : *c) {
                 if (has_all_args) {
-                    if (expr* d = m_cache[arg]) {
+                    if (expr* d = get_cached(arg)) {
                         m_args.push_back(d);
                         arg_differs |= arg != d;
                         SASSERT(arg->get_sort() == d->get_sort());
@@ -89,7 +88,7 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
                 } else {
                     b = a;
                 }
-                cached = b;
+                cache_result(a, b);
                 m_todo.pop_back();
             }
         }
@@ -108,7 +107,7 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
 
             if (all_repls_ground) {
                 bool has_all_data = true;
-                new_body = m_cache[q->get_expr()];
+                new_body = get_cached(q->get_expr());
                 if (!new_body) {
                     m_todo.push_back(q->get_expr());
                     has_all_data = false;
@@ -117,7 +116,7 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
                 unsigned np = q->get_num_patterns();
                 for (unsigned i = 0; i < np; ++i) {
                     if (has_all_data) {
-                        if (expr * p = m_cache[q->get_pattern(i)]) {
+                        if (expr * p = get_cached(q->get_pattern(i))) {
                             pats.push_back(p);
                             continue;
                         }
@@ -128,7 +127,7 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
                 np = q->get_num_no_patterns();
                 for (unsigned i = 0; i < np; ++i) {
                     if (has_all_data) {
-                        if (expr * p = m_cache[q->get_no_pattern(i)]) {
+                        if (expr * p = get_cached(q->get_no_pattern(i))) {
                             nopats.push_back(p);
                             continue;
                         }
@@ -183,13 +182,13 @@ void expr_safe_replace::operator()(expr* e, expr_ref& res) {
             }
             b = m.update_quantifier(q, pats.size(), pats.data(), nopats.size(), nopats.data(), new_body);
             m_refs.push_back(b);
-            cached = b;
+            cache_result(a, b);
             m_todo.pop_back();
-        }        
+        }
     }
-    res = m_cache.at(e);
+    res = get_cached(e);
     if (m_refs.size() > 1 << 20) {
-        m_cache.clear();
+        m_cache.reset();
         m_refs.reset();
     }
     m_todo.reset();
@@ -200,7 +199,7 @@ void expr_safe_replace::reset() {
     m_src.reset();
     m_dst.reset();
     m_refs.finalize();
-    m_cache.clear();
+    m_cache.finalize();
 }
 
 void expr_safe_replace::apply_substitution(expr* s, expr* def, expr_ref& t) {
@@ -217,7 +216,7 @@ void expr_safe_replace::push_scope() {
 void expr_safe_replace::pop_scope(unsigned n) {
     unsigned old_sz = m_limit[m_limit.size() - n];
     if (old_sz != m_src.size()) {
-        m_cache.clear();
+        m_cache.reset();
         m_src.shrink(old_sz);
         m_dst.shrink(old_sz);
     }
@@ -22,7 +22,6 @@ Revision History:
 #pragma once
 
 #include "ast/ast.h"
-#include <unordered_map>
 
 class expr_safe_replace {
     ast_manager& m;
@@ -31,7 +30,13 @@ class expr_safe_replace {
     unsigned_vector m_limit = 0;
     ptr_vector<expr> m_todo, m_args;
     expr_ref_vector m_refs;
-    std::unordered_map<expr*,expr*> m_cache;
+    // Result cache indexed directly by AST id. Ids are allocated densely by the
+    // manager, so this trades a bit of memory for hash-free probes in the main loop.
+    // m_refs pins cached results, hence ids are not recycled while the cache is live.
+    ptr_vector<expr> m_cache;
+
+    expr* get_cached(expr* a) const { return m_cache.get(a->get_id(), nullptr); }
+    void cache_result(expr* a, expr* b) { m_cache.setx(a->get_id(), b, nullptr); }
 
 public:
     expr_safe_replace(ast_manager& m): m(m), m_src(m), m_dst(m), m_refs(m) {}
@@ -5635,10 +5635,10 @@ bool seq_rewriter::is_string(unsigned n, expr* const* es, zstring& s) const {
     unsigned ch;
     for (unsigned i = 0; i < n; ++i) {
         if (str().is_string(es[i], s1)) {
-            s = s + s1;
+            s += s1;
         }
         else if (str().is_unit(es[i], e) && m_util.is_const_char(e, ch)) {
-            s = s + zstring(ch);
+            s += zstring(ch);
         }
         else {
             return false;
@@ -5910,14 +5910,26 @@ bool seq_rewriter::reduce_subsequence(expr_ref_vector& ls, expr_ref_vector& rs,
 } 
 
 seq_rewriter::op_cache::op_cache(ast_manager& m):
-    m_trail(m)
+    m_trail(m),
+    m_old_trail(m)
 {}
 
 expr* seq_rewriter::op_cache::find(decl_kind op, expr* a, expr* b, expr* c) {
     op_entry e(op, a, b, c, nullptr);
-    m_table.find(e, e);
-
-    return e.r;
+    if (m_table.find(e, e))
+        return e.r;
+    if (m_old_table.find(e, e)) {
+        // promote entries that are still in use into the current generation;
+        // do not go through insert(): cleanup() could rotate the old generation
+        // away before the promoted entry is pinned by m_trail
+        if (a) m_trail.push_back(a);
+        if (b) m_trail.push_back(b);
+        if (c) m_trail.push_back(c);
+        m_trail.push_back(e.r);
+        m_table.insert(e);
+        return e.r;
+    }
+    return nullptr;
 }
 
 void seq_rewriter::op_cache::insert(decl_kind op, expr* a, expr* b, expr* c, expr* r) {
@@ -5931,8 +5943,13 @@ void seq_rewriter::op_cache::insert(decl_kind op, expr* a, expr* b, expr* c, exp
 
 void seq_rewriter::op_cache::cleanup() {
     if (m_table.size() >= m_max_cache_size) {
-        m_trail.reset();
-        m_table.reset();
+        // age the current generation instead of discarding it; entries that
+        // are hit again are promoted back by find(), the rest are dropped
+        // at the next rotation
+        m_old_trail.reset();
+        m_old_table.reset();
+        m_old_trail.swap(m_trail);
+        m_old_table.swap(m_table);
         STRACE(seq_regex, tout << "Op cache reset!" << std::endl;);
         STRACE(seq_regex_brief, tout << "(OP CACHE RESET) ";);
         STRACE(seq_verbose, tout << "Derivative op cache reset" << std::endl;);
@@ -119,6 +119,10 @@ class seq_rewriter {
         unsigned        m_max_cache_size { 10000 };
         expr_ref_vector m_trail;
         op_table        m_table;
+        // previous generation of cache entries, kept so that hot derivative
+        // results survive a cleanup instead of being re-derived from scratch
+        expr_ref_vector m_old_trail;
+        op_table        m_old_table;
         void cleanup();
 
     public:
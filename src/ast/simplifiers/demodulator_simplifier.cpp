@@ -129,6 +129,20 @@ bool demodulator_simplifier::rewrite1(func_decl* f, expr_ref_vector const& args,
 
         SASSERT(lhs->get_decl() == f);
 
+        // cheap fingerprint filter: a non-variable pattern argument can only
+        // match a term with the same head symbol, so mismatching candidates
+        // are skipped without attempting a full match.
+        bool ok = true;
+        for (unsigned j = 0; ok && j < args.size(); ++j) {
+            expr* pa = lhs->get_arg(j);
+            expr* ta = args.get(j);
+            if (is_var(pa))
+                continue;
+            if (is_app(pa))
+                ok = is_app(ta) ? to_app(pa)->get_decl() == to_app(ta)->get_decl() : !is_var(ta);
+        }
+        if (!ok)
+            continue;
 
         if (m_match_subst(lhs, rhs, args.data(), np)) {
             TRACE(demodulator_bug, tout << "succeeded...\n" << mk_pp(rhs, m) << "\n===>\n" << np << "\n");
@@ -43,7 +43,6 @@ expr_ref dominator_simplifier::simplify_ite(app * ite) {
         
         local_pop(scope_level() - old_lvl);
         expr_ref new_t = simplify_arg(t);
-        reset_cache();
         if (!assert_expr(new_c, true)) {
             return new_t;
         }
@@ -62,9 +61,8 @@ expr_ref dominator_simplifier::simplify_ite(app * ite) {
         else {
             TRACE(simplify, tout << new_c << "\n" << new_t << "\n" << new_e << "\n";);
             r = m.mk_ite(new_c, new_t, new_e);
-        }        
+        }
     }
-    reset_cache();
     return r;
 }
 
@@ -82,12 +80,10 @@ expr_ref dominator_simplifier::simplify_arg(expr * e) {
 */
 expr_ref dominator_simplifier::simplify_rec(expr * e0) {
     expr_ref r(m);
-    expr* e = nullptr;
+    // cache entries are tagged with the assumption context they were computed
+    // under; get_cached only reuses results from an equivalent context.
+    expr* e = get_cached(e0);
 
-    if (!m_result.find(e0, e)) {
-        e = e0;
-    }
-    
     ++m_depth;
     if (m_depth > m_max_depth) {
         r = e;
@@ -159,9 +155,8 @@ expr_ref dominator_simplifier::simplify_and_or(bool is_and, app * e) {
         r = simplify_arg(arg);                              
         args.push_back(r);                                  
         if (!assert_expr(r, !is_and)) {                     
-            local_pop(scope_level() - old_lvl);                   
-            r = is_and ? m.mk_false() : m.mk_true();        
-            reset_cache();
+            local_pop(scope_level() - old_lvl);
+            r = is_and ? m.mk_false() : m.mk_true();
             return true;
         }                     
         return false;
@@ -182,7 +177,6 @@ expr_ref dominator_simplifier::simplify_and_or(bool is_and, app * e) {
     }
     
     local_pop(scope_level() - old_lvl);
-    reset_cache();
     return { is_and ? mk_and(args) : mk_or(args), m };
 }
 
@@ -192,7 +186,6 @@ expr_ref dominator_simplifier::simplify_not(app * e) {
     unsigned old_lvl = scope_level();
     expr_ref t = simplify_rec(ee);
     local_pop(scope_level() - old_lvl);
-    reset_cache();
     return mk_not(t);
 }
 
@@ -204,7 +197,7 @@ bool dominator_simplifier::init() {
         if (!m_fmls[i].dep())
             args.push_back(m_fmls[i].fml());
     expr_ref fml = mk_and(args);
-    m_result.reset();
+    reset_cache();
     m_trail.reset();
     return m_dominators.compile(fml);
 }
@@ -214,7 +207,7 @@ void dominator_simplifier::reduce() {
 
     m_trail.reset();
     m_args.reset();
-    m_result.reset();
+    reset_cache();
     m_dominators.reset();
 
     SASSERT(scope_level() == 0);
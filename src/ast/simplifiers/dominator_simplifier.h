@@ -13,14 +13,23 @@ Module Name:
 #include "ast/rewriter/dom_simplifier.h"
 #include "ast/simplifiers/dependent_expr_state.h"
 #include "util/obj_pair_hashtable.h"
+#include "util/map.h"
 
 class dominator_simplifier : public dependent_expr_simplifier {
 
     ast_manager&         m;
     dom_simplifier*      m_simplifier;
     params_ref           m_params;
+    // Assumption contexts are interned in a trie: a context id identifies the
+    // sequence of (literal, sign) assertions leading to it, so branches that
+    // re-assert an equivalent assumption suffix map to the same id and can
+    // share cached simplification results instead of recomputing them.
+    typedef std::pair<unsigned, unsigned> ctx_key; // (parent context id, 2*literal id + sign)
     expr_ref_vector      m_trail, m_args;
-    obj_map<expr, expr*> m_result;
+    obj_map<expr, std::pair<unsigned, expr*>> m_result;
+    map<ctx_key, unsigned, pair_hash<unsigned_hash, unsigned_hash>, default_eq<ctx_key>> m_ctx_ids;
+    unsigned             m_ctx = 0;        // interned id of the current assumption context
+    svector<std::pair<unsigned, unsigned>> m_ctx_trail; // (scope level at assertion, previous context id)
     expr_dominators      m_dominators;
     unsigned             m_depth;
     unsigned             m_max_depth;
@@ -40,16 +49,43 @@ class dominator_simplifier : public dependent_expr_simplifier {
 
     bool is_subexpr(expr * a, expr * b);
 
-    expr_ref get_cached(expr* t) { expr* r = nullptr; if (!m_result.find(t, r)) r = t; return expr_ref(r, m); }
-    void cache(expr *t, expr* r) { m_result.insert(t, r); m_trail.push_back(r); m_trail.push_back(t); }
-    void reset_cache() { m_result.reset(); }
+    expr_ref get_cached(expr* t) {
+        std::pair<unsigned, expr*> r;
+        if (m_result.find(t, r) && r.first == m_ctx)
+            return expr_ref(r.second, m);
+        return expr_ref(t, m);
+    }
+    void cache(expr *t, expr* r) { m_result.insert(t, {m_ctx, r}); m_trail.push_back(r); m_trail.push_back(t); }
+    void reset_cache() { m_result.reset(); m_ctx_ids.reset(); m_ctx_trail.reset(); m_ctx = 0; }
 
     ptr_vector<expr> const & tree(expr * e);
     expr* idom(expr *e) const { return m_dominators.idom(e); }
 
     unsigned scope_level() { return m_simplifier->scope_level(); }
-    void local_pop(unsigned n) { SASSERT(n <= m_simplifier->scope_level()); m_simplifier->pop(n); }
-    bool assert_expr(expr* f, bool sign) { return m_simplifier->assert_expr(f, sign); }
+    void local_pop(unsigned n) {
+        SASSERT(n <= m_simplifier->scope_level());
+        m_simplifier->pop(n);
+        unsigned lvl = m_simplifier->scope_level();
+        while (!m_ctx_trail.empty() && m_ctx_trail.back().first >= lvl) {
+            m_ctx = m_ctx_trail.back().second;
+            m_ctx_trail.pop_back();
+        }
+    }
+    bool assert_expr(expr* f, bool sign) {
+        unsigned lvl = scope_level();
+        if (!m_simplifier->assert_expr(f, sign))
+            return false;
+        m_ctx_trail.push_back({lvl, m_ctx});
+        m_trail.push_back(f);
+        ctx_key key(m_ctx, 2 * f->get_id() + (sign ? 1 : 0));
+        unsigned id;
+        if (!m_ctx_ids.find(key, id)) {
+            id = m_ctx_ids.size() + 1;
+            m_ctx_ids.insert(key, id);
+        }
+        m_ctx = id;
+        return true;
+    }
 
 
 public:
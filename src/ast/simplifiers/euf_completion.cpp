@@ -82,6 +82,7 @@ namespace euf {
 
         std::function<void(euf::enode*, euf::enode*)> _on_merge =
             [&](euf::enode* root, euf::enode* other) {
+            ++m_num_merges;
             m_mam->on_merge(root, other);
             watch_rule(root, other);
             };
@@ -189,6 +190,7 @@ namespace euf {
         clear_propagation_queue();
         dependent_expr_simplifier::pop(n);
         m_egraph.pop(n);
+        m_epoch_nodes = UINT_MAX; // node ids can be recycled after a pop; force cache invalidation
         if (m_side_condition_solver)
             m_side_condition_solver->pop(n);
     }
@@ -226,9 +228,15 @@ namespace euf {
     void completion::reduce() {
         m_has_new_eq = true;
         for (unsigned rounds = 0; m_has_new_eq && rounds <= 3 && !should_stop(); ++rounds) {
-            ++m_epoch;
             m_has_new_eq = false;
             add_egraph();
+            // the canonical cache is keyed by node id and epoch; only invalidate it
+            // when the egraph changed since the last bump.
+            if (m_num_merges != m_epoch_merges || m_egraph.num_nodes() != m_epoch_nodes) {
+                ++m_epoch;
+                m_epoch_merges = m_num_merges;
+                m_epoch_nodes = m_egraph.num_nodes();
+            }
             map_canonical();
             read_egraph();
             IF_VERBOSE(1, verbose_stream() << "(euf.completion :rounds " << rounds << " :instances " << m_stats.m_num_instances << " :stop " << should_stop() << ")\n");
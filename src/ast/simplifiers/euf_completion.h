@@ -140,6 +140,9 @@ namespace euf {
         vector<std::pair<proof_ref, expr_dependency*>> m_pr_dep;
         unsigned               m_epoch = 0;
         unsigned_vector        m_epochs;
+        unsigned               m_num_merges = 0;           // merges observed via on_merge
+        unsigned               m_epoch_merges = 0;         // egraph version at the last epoch bump
+        unsigned               m_epoch_nodes = UINT_MAX;   // UINT_MAX forces a bump on the next round
         th_rewriter            m_rewriter;
         ho_matcher             m_matcher;
         stats                  m_stats;
@@ -68,36 +68,47 @@ void propagate_values::reduce() {
     m_shared.reset();
     m_subst.reset();
 
-    auto add_shared = [&]() {
-        shared_occs_mark visited;
-        m_shared.reset();
-        for (unsigned i = 0; i < qtail(); ++i)
+    if (qhead() == qtail())
+        return;
+
+    shared_occs_mark visited;
+
+    // Shared occurrences accumulate monotonically with a persistent visited
+    // mark, so only terms not walked before are visited by later passes.
+    // This over-approximates sharedness of the current formulas, which is
+    // sound: is_shared only filters which substitutions are worth recording.
+    for (unsigned i = 0; i < qtail(); ++i)
+        m_shared(m_fmls[i].fml(), visited);
+
+    auto init_pass = [&]() {
+        // updated delta formulas can expose new shared occurrences; the
+        // visited mark keeps this walk proportional to the changed terms.
+        for (unsigned i = qhead(); i < qtail(); ++i)
             m_shared(m_fmls[i].fml(), visited);
-    };   
-   
-    auto init_sub = [&]() {
-        add_shared();
+        // the substitution is rebuilt every pass: a substitution kept across
+        // passes would apply the entry derived from a formula to that same
+        // formula on the next pass and erase the assertion.
         m_subst.reset();
         m_rewriter.reset();
         m_rewriter.set_substitution(&m_subst);
         for (unsigned i = 0; i < qhead(); ++i)
             add_sub(m_fmls[i]);
     };
-    
+
     unsigned rw = m_stats.m_num_rewrites + 1;
-    for (unsigned r = 0; r < m_max_rounds && m.inc() && rw != m_stats.m_num_rewrites; ++r) {            
+    for (unsigned r = 0; r < m_max_rounds && m.inc() && rw != m_stats.m_num_rewrites; ++r) {
         rw = m_stats.m_num_rewrites;
-        init_sub();
+        init_pass();
         for (unsigned i : indices())
             process_fml(i);
-        init_sub();
+        init_pass();
         for (unsigned i = qtail(); i-- > qhead() && m.inc() && !m_fmls.inconsistent();)
             process_fml(i);
         if (m_subst.empty())
             break;
     }
-    
-    m_rewriter.set_substitution(nullptr);        
+
+    m_rewriter.set_substitution(nullptr);
     m_rewriter.reset();
     m_subst.reset();
     m_shared.reset();
@@ -84,62 +84,16 @@ class reduce_args_simplifier : public dependent_expr_simplifier {
         return may_be_unique(m, bv, e, base);
     }
     
-    struct find_non_candidates_proc {
-        ast_manager &              m;
-        bv_util &                  m_bv;
-        obj_hashtable<func_decl> & m_non_candidates;
-        
-        find_non_candidates_proc(ast_manager & m, bv_util & bv, obj_hashtable<func_decl> & non_candidates):
-            m(m),
-            m_bv(bv),
-            m_non_candidates(non_candidates) {
-        }
-        
-        void operator()(var * n) {}
-        
-        void operator()(quantifier *n) {}
-        
-        void operator()(app * n) {
-            if (!is_uninterp(n))
-                return;
-            func_decl * d;
-            if (n->get_num_args() == 0)
-                return; // ignore constants
-            d = n->get_decl();
-            if (m_non_candidates.contains(d))
-                return; // it is already in the set.
-            for (expr* arg : *n)
-                if (may_be_unique(m, m_bv, arg))
-                    return;
-            m_non_candidates.insert(d);
-        }
-    };
-
-    /**
-       \brief Populate the table non_candidates with function declarations \c f
-       such that there is a function application (f t1 ... tn) where t1 ... tn are not values.
-    */
-    void find_non_candidates(obj_hashtable<func_decl> & non_candidates) {
-        non_candidates.reset();
-        find_non_candidates_proc proc(m, m_bv, non_candidates);
-        expr_fast_mark1 visited;
-        for (auto i : indices())
-            quick_for_each_expr(proc, visited, m_fmls[i].fml());
-
-        TRACE(reduce_args, tout << "non_candidates:\n"; for (func_decl* d : non_candidates) tout << d->get_name() << "\n";);
-    }
-
     struct populate_decl2args_proc {
         reduce_args_simplifier&           m_owner;
         ast_manager &                     m;
         bv_util &                         m_bv;
-        obj_hashtable<func_decl> &        m_non_candidates;
-        obj_map<func_decl, bit_vector> &  m_decl2args;    
+        obj_map<func_decl, bit_vector> &  m_decl2args;
         obj_map<func_decl, svector<expr*> > m_decl2base; // for args = base + offset
 
-        populate_decl2args_proc(reduce_args_simplifier& o, ast_manager & m, bv_util & bv, obj_hashtable<func_decl> & nc, obj_map<func_decl, bit_vector> & d):
-            m_owner(o), m(m), m_bv(bv), m_non_candidates(nc), m_decl2args(d) {}
-        
+        populate_decl2args_proc(reduce_args_simplifier& o, ast_manager & m, bv_util & bv, obj_map<func_decl, bit_vector> & d):
+            m_owner(o), m(m), m_bv(bv), m_decl2args(d) {}
+
         void operator()(var * n) {}
         void operator()(quantifier * n) {}
         void operator()(app * n) {
@@ -148,11 +102,9 @@ class reduce_args_simplifier : public dependent_expr_simplifier {
             func_decl * d = n->get_decl();
             if (d->get_family_id() != null_family_id)
                 return; // ignore interpreted symbols
-            if (m_non_candidates.contains(d))
-                return; // declaration is not a candidate
             if (m_owner.m_fmls.frozen(d))
                 return;
-            
+
             unsigned j = n->get_num_args();
             obj_map<func_decl, bit_vector>::iterator it = m_decl2args.find_iterator(d);
             expr* base;
@@ -179,15 +131,17 @@ class reduce_args_simplifier : public dependent_expr_simplifier {
         }
     };
 
-    void populate_decl2args(obj_hashtable<func_decl> & non_candidates, 
-                            obj_map<func_decl, bit_vector> & decl2args) {
+    void populate_decl2args(obj_map<func_decl, bit_vector> & decl2args) {
         expr_fast_mark1 visited;
         decl2args.reset();
-        populate_decl2args_proc proc(*this, m, m_bv, non_candidates, decl2args);
-        for (auto i : indices()) 
+        populate_decl2args_proc proc(*this, m, m_bv, decl2args);
+        for (auto i : indices())
             quick_for_each_expr(proc, visited, m_fmls[i].fml());
-        
+
         // Remove all cases where the simplification is not applicable.
+        // An application whose arguments are all non-unique zeroes every bit
+        // of its declaration, so this also covers what a separate
+        // non-candidate prefilter pass would find.
         ptr_buffer<func_decl> bad_decls;
         for (auto const& [k, v] : decl2args) 
             if (all_of(v, [&](auto b) { return !b;}))
@@ -388,10 +342,8 @@ public:
     void reduce() override {
         m_fmls.freeze_suffix();
         
-        obj_hashtable<func_decl> non_candidates;
         obj_map<func_decl, bit_vector> decl2args;
-        find_non_candidates(non_candidates);
-        populate_decl2args(non_candidates, decl2args);
+        populate_decl2args(decl2args);
 
         if (decl2args.empty())
             return;
@@ -395,8 +395,14 @@ namespace sat {
         return m_flips >= m_restart_next;
     }
     
-    void ddfw::do_restart() {    
-        reinit_values();
+    void ddfw::do_restart() {
+        if (m_shared_best && m_shared_best->adopt(m_min_sz, m_shared_values)) {
+            // another walker found a strictly better assignment; cross over to it.
+            for (unsigned i = 0; i < num_vars() && i < m_shared_values.size(); ++i)
+                value(i) = m_shared_values[i];
+        }
+        else
+            reinit_values();
         init_clause_data();
         m_restart_next += m_config.m_restart_base*get_luby(++m_restart_count);
     }
@@ -452,6 +458,12 @@ namespace sat {
         if (m_unsat.size() < m_min_sz) {
             m_models.reset();
             m_min_sz = m_unsat.size();
+            if (m_shared_best) {
+                m_shared_values.reserve(num_vars());
+                for (unsigned v = 0; v < num_vars(); ++v)
+                    m_shared_values[v] = value(v);
+                m_shared_best->publish(m_min_sz, m_shared_values);
+            }
         }
         
         unsigned h = value_hash();
@@ -29,10 +29,38 @@
 #include "util/sat_literal.h"
 #include "util/statistics.h"
 #include "util/stopwatch.h"
+#include "util/mutex.h"
 
 
 namespace sat {
 
+    /**
+       \brief Best assignment shared between walkers that search the same
+       clause set in parallel. Walkers publish strict improvements and adopt
+       the global best at restarts, so no walker stays stuck on a plateau
+       another walker has already escaped.
+    */
+    class ddfw_shared_best {
+        mutex        m_mutex;
+        unsigned     m_best_sz = UINT_MAX;
+        bool_vector  m_values;
+    public:
+        void publish(unsigned sz, bool_vector const& values) {
+            lock_guard lock(m_mutex);
+            if (sz < m_best_sz) {
+                m_best_sz = sz;
+                m_values = values;
+            }
+        }
+        bool adopt(unsigned sz, bool_vector& values) {
+            lock_guard lock(m_mutex);
+            if (m_best_sz >= sz)
+                return false;
+            values = m_values;
+            return true;
+        }
+    };
+
     class local_search_plugin {
     public:
         virtual ~local_search_plugin() {}
@@ -109,6 +137,8 @@ namespace sat {
 
         scoped_ptr<local_search_plugin> m_plugin = nullptr;
         std::function<bool(void)> m_parallel_sync;
+        ddfw_shared_best* m_shared_best = nullptr;
+        bool_vector       m_shared_values;
 
         bool flatten_use_list(); 
 
@@ -229,6 +259,8 @@ namespace sat {
 
         void set_plugin(local_search_plugin* p) { m_plugin = p; }
 
+        void set_shared_best(ddfw_shared_best* s) { m_shared_best = s; }
+
         lbool check(unsigned sz, literal const* assumptions);
 
         void updt_params(params_ref const& p);
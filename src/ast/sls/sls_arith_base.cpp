@@ -794,11 +794,8 @@ namespace sls {
 
         IF_VERBOSE(10, verbose_stream() << "new value eh " << mk_bounded_pp(e, m) << "\n");
 
-        for (auto idx : vi.m_muls)
-            ctx.new_value_eh(m_vars[m_muls[idx].m_var].m_expr);
-        for (auto idx : vi.m_adds) 
-            ctx.new_value_eh(m_vars[m_adds[idx].m_var].m_expr);
-
+        // dependent muls/adds are notified by the recursive update below,
+        // and only when their value genuinely changes.
         for (auto idx : vi.m_muls) {
             auto const& [w, monomial] = m_muls[idx];
             num_t prod(1);
@@ -815,10 +812,12 @@ namespace sls {
 
         for (auto idx : vi.m_adds) {
             auto const& ad = m_adds[idx];
-            num_t sum(ad.m_coeff);
+            // only v changed, so the sum moves by coeff-of-v times delta.
+            num_t sum = value(ad.m_var);
             for (auto const& [coeff, w] : ad.m_args)
-                sum += coeff * value(w);
-            if (!update_checked(ad.m_var, sum)) 
+                if (w == v)
+                    sum += coeff * (new_value - old_value);
+            if (value(ad.m_var) != sum && !update_checked(ad.m_var, sum))
                 return false;
         }
 
@@ -2707,6 +2706,8 @@ namespace sls {
     void arith_base<num_t>::update_unchecked(var_t v, num_t const& new_value) {
         auto& vi = m_vars[v];
         auto old_value = value(v);
+        if (old_value == new_value)
+            return;
         IF_VERBOSE(5, verbose_stream() << "update: v" << v << " " << mk_bounded_pp(vi.m_expr, m) << " := " << old_value << " -> " << new_value << "\n");
         TRACE(arith, tout << "update: v" << v << " " << mk_bounded_pp(vi.m_expr, m) << " := " << old_value << " -> " << new_value << "\n");
         vi.set_value(new_value);
@@ -2727,9 +2728,11 @@ namespace sls {
 
         for (auto const& idx : vi.m_adds) {
             auto& ad = m_adds[idx];
-            num_t new_sum(ad.m_coeff);
+            // only v changed, so the sum moves by coeff-of-v times delta.
+            num_t new_sum = value(ad.m_var);
             for (auto [c, w] : ad.m_args)
-                new_sum += c * value(w);
+                if (w == v)
+                    new_sum += c * (new_value - old_value);
             update_unchecked(ad.m_var, new_sum);
         }
 
@@ -105,12 +105,18 @@ namespace sls {
         SASSERT(max_n < UINT_MAX / 2);
         unsigned p = 1;
         unsigned value = 0;
+        unsigned const digit_bits = 8 * sizeof(digit_t);
         for (unsigned i = 0; i < bw; ++i) {
             if (p >= max_n) {
-                for (unsigned j = i; j < bw; ++j)
-                    if (get(j))
+                // any remaining set bit saturates; scan the tail word-wise.
+                unsigned j = i / digit_bits;
+                digit_t w = (*this)[j] & ~(get_pos_mask(i) - 1);
+                for (;; w = (*this)[++j]) {
+                    if (j == nw - 1)
+                        return (w & mask) != 0 ? max_n : value;
+                    if (w != 0)
                         return max_n;
-                return value;
+                }
             }
             if (get(i))
                 value += p;
@@ -127,13 +133,26 @@ namespace sls {
 
     bvect& bvect::set_shift_right(bvect const& a, unsigned shift) {
         set_bw(a.bw);
+        unsigned const digit_bits = 8 * sizeof(digit_t);
+        // mask out junk above bw when reading the most significant word.
+        auto word = [&](unsigned j) -> digit_t {
+            if (j >= nw)
+                return 0;
+            return j == nw - 1 ? a[j] & mask : a[j];
+        };
         if (shift == 0)
             a.copy_to(a.nw, *this);
         else if (shift >= a.bw)
             set_zero();
-        else
-            for (unsigned i = 0; i < bw; ++i)
-                set(i, i + shift < bw ? a.get(i + shift) : false);
+        else {
+            unsigned wshift = shift / digit_bits;
+            unsigned bshift = shift % digit_bits;
+            for (unsigned i = 0; i < nw; ++i) {
+                digit_t lo = word(i + wshift);
+                digit_t hi = word(i + wshift + 1);
+                (*this)[i] = bshift == 0 ? lo : (lo >> bshift) | (hi << (digit_bits - bshift));
+            }
+        }
         return *this;
     }
 
@@ -142,13 +161,21 @@ namespace sls {
         SASSERT(a.bw == b.bw);
         unsigned shift = b.to_nat(b.bw);
 
+        unsigned const digit_bits = 8 * sizeof(digit_t);
         if (shift == 0)
             a.copy_to(a.nw, *this);
         else if (shift >= a.bw)
             set_zero();
-        else
-            for (unsigned i = bw; i-- > 0; )
-                set(i, i >= shift ? a.get(i - shift) : false);
+        else {
+            unsigned wshift = shift / digit_bits;
+            unsigned bshift = shift % digit_bits;
+            for (unsigned i = nw; i-- > 0; ) {
+                digit_t hi = i >= wshift ? a[i - wshift] : 0;
+                digit_t lo = i >= wshift + 1 ? a[i - wshift - 1] : 0;
+                (*this)[i] = bshift == 0 ? hi : (hi << bshift) | (lo >> (digit_bits - bshift));
+            }
+            (*this)[nw - 1] &= mask;
+        }
         return *this;
     }
 
@@ -514,8 +541,15 @@ namespace sls {
 
     void bv_valuation::shift_right(bvect& out, unsigned shift) const {
         SASSERT(shift < bw);
-        for (unsigned i = 0; i < bw; ++i)
-            out.set(i, i + shift < bw ? out.get(i + shift) : false);
+        unsigned const digit_bits = 8 * sizeof(digit_t);
+        unsigned wshift = shift / digit_bits;
+        unsigned bshift = shift % digit_bits;
+        out[nw - 1] &= mask;
+        for (unsigned i = 0; i < nw; ++i) {
+            digit_t lo = i + wshift < nw ? out[i + wshift] : 0;
+            digit_t hi = i + wshift + 1 < nw ? out[i + wshift + 1] : 0;
+            out[i] = bshift == 0 ? lo : (lo >> bshift) | (hi << (digit_bits - bshift));
+        }
         SASSERT(well_formed());
     }
 
@@ -279,25 +279,22 @@ namespace sls {
         }
 
         void sub1(bvect& out) const {
-            for (unsigned i = 0; i < bw; ++i) {
-                if (out.get(i)) {
-                    out.set(i, false);
-                    return;
+            for (unsigned i = 0; i < nw; ++i) {
+                if (out[i] != 0) {
+                    --out[i];
+                    break;
                 }
-                else
-                    out.set(i, true);
+                out[i] = ~(digit_t)0;
             }
+            clear_overflow_bits(out);
         }
 
         void add1(bvect& out) const {
-            for (unsigned i = 0; i < bw; ++i) {
-                if (!out.get(i)) {
-                    out.set(i, true);
-                    return;
-                }
-                else
-                    out.set(i, false);
+            for (unsigned i = 0; i < nw; ++i) {
+                if (++out[i] != 0)
+                    break;
             }
+            clear_overflow_bits(out);
         }
 
         void set_sub(bvect& out, bvect const& a, bvect const& b) const;
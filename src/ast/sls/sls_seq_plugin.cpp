@@ -409,7 +409,7 @@ namespace sls {
             case OP_SEQ_CONCAT: {
                 zstring r;
                 for (auto arg : *to_app(e))
-                    r = r + strval0(arg);
+                    r += strval0(arg);
                 ev.val1.svalue = r;
                 return ev.val1.svalue;
             }
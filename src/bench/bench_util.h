@@ -0,0 +1,83 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    bench_util.h
+
+Abstract:
+
+    Timing and statistics helpers for the z3-bench microbenchmarks.
+
+    A benchmark is a callable that performs one measured iteration.
+    bench::run executes it a configurable number of warmup rounds
+    (discarded), then a configurable number of measured repetitions,
+    and reports mean, standard deviation, and min/max so that noisy
+    runs are visible instead of hiding behind a single number.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+--*/
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include "util/stopwatch.h"
+#include "util/vector.h"
+
+namespace bench {
+
+    struct config {
+        unsigned m_warmup = 2;
+        unsigned m_repetitions = 5;
+    };
+
+    inline config & get_config() {
+        static config c;
+        return c;
+    }
+
+    inline void report(char const * name, svector<double> const & times) {
+        double sum = 0, mn = times[0], mx = times[0];
+        for (double t : times) {
+            sum += t;
+            mn = std::min(mn, t);
+            mx = std::max(mx, t);
+        }
+        double mean = sum / times.size();
+        double var = 0;
+        for (double t : times)
+            var += (t - mean) * (t - mean);
+        double sd = times.size() > 1 ? std::sqrt(var / (times.size() - 1)) : 0;
+        std::cout << std::left << std::setw(24) << name << std::right
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << mean * 1000 << " ms"
+                  << "  +/- " << std::setw(7) << sd * 1000 << " ms"
+                  << " (" << std::setprecision(1)
+                  << (mean > 0 ? 100 * sd / mean : 0) << "%)"
+                  << std::setprecision(2)
+                  << "  min " << mn * 1000 << " ms"
+                  << "  max " << mx * 1000 << " ms"
+                  << "  n=" << times.size()
+                  << std::endl;
+    }
+
+    template<typename Fn>
+    void run(char const * name, Fn && body) {
+        config const & c = get_config();
+        for (unsigned i = 0; i < c.m_warmup; i++)
+            body();
+        svector<double> times;
+        for (unsigned i = 0; i < c.m_repetitions; i++) {
+            stopwatch sw;
+            sw.start();
+            body();
+            sw.stop();
+            times.push_back(sw.get_seconds());
+        }
+        report(name, times);
+    }
+}
@@ -0,0 +1,53 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Abstract:
+
+    Benchmark egraph merges: w chains of depth d over a common function
+    vocabulary; merging the chain roots triggers congruence propagation
+    along the full chains. The graph is rebuilt per repetition since
+    merges mutate it.
+
+--*/
+
+#include <string>
+#include "util/util.h"
+#include "ast/euf/euf_egraph.h"
+#include "ast/reg_decl_plugins.h"
+#include "bench_util.h"
+
+void bnc_egraph_merge() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    sort_ref S(m.mk_uninterpreted_sort(symbol("S")), m);
+
+    unsigned w = 100, d = 100;
+    func_decl_ref_vector fs(m);
+    for (unsigned j = 0; j < d; ++j) {
+        std::string name("f");
+        name += std::to_string(j);
+        fs.push_back(m.mk_func_decl(symbol(name.c_str()), S, S));
+    }
+
+    bench::run("egraph_merge", [&]() {
+        euf::egraph g(m);
+        euf::enode_vector nodes;
+        expr_ref_vector pinned(m);
+        for (unsigned i = 0; i < w; ++i) {
+            std::string name("x");
+            name += std::to_string(i);
+            expr_ref x(m.mk_const(symbol(name.c_str()), S), m);
+            pinned.push_back(x);
+            euf::enode * n = g.mk(x, 0, 0, nullptr);
+            nodes.push_back(n);
+            for (unsigned j = 0; j < d; ++j) {
+                x = m.mk_app(fs.get(j), x.get());
+                pinned.push_back(x);
+                n = g.mk(x, 0, 1, &n);
+            }
+        }
+        for (euf::enode * n : nodes)
+            g.merge(n, nodes[0], nullptr);
+        g.propagate();
+    });
+}
@@ -0,0 +1,37 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Abstract:
+
+    Benchmark lar_solver on a feasibility problem with overlapping term
+    bounds; the cost is dominated by simplex pivoting.
+
+--*/
+
+#include "util/util.h"
+#include "math/lp/lar_solver.h"
+#include "bench_util.h"
+
+void bnc_lar_solver() {
+    bench::run("lar_solver", []() {
+        lp::lar_solver s;
+        unsigned N = 400;
+        svector<lp::lpvar> vars;
+        for (unsigned i = 0; i < N; ++i) {
+            lp::lpvar v = s.add_var(i, false);
+            vars.push_back(v);
+            s.add_var_bound(v, lp::lconstraint_kind::GE, lp::mpq(1));
+        }
+        unsigned ti = 0;
+        for (unsigned i = 0; i < 2 * N; ++i) {
+            vector<std::pair<lp::mpq, lp::lpvar>> pairs;
+            pairs.push_back(std::make_pair(lp::mpq(1 + (i % 3)), vars[i % N]));
+            pairs.push_back(std::make_pair(lp::mpq(1 + ((i + 1) % 3)), vars[(i + 133) % N]));
+            pairs.push_back(std::make_pair(lp::mpq(1 + ((i + 2) % 3)), vars[(i + 266) % N]));
+            unsigned t = s.add_term(pairs, N + ti++);
+            s.add_var_bound(t, lp::lconstraint_kind::GE, lp::mpq(3));
+            s.add_var_bound(t, lp::lconstraint_kind::LE, lp::mpq(10));
+        }
+        s.solve();
+    });
+}
@@ -0,0 +1,115 @@
+#include<iostream>
+#include<cstring>
+#include<string>
+#include "util/util.h"
+#include "util/trace.h"
+#include "util/debug.h"
+#include "util/warning.h"
+#include "util/memory_manager.h"
+#include "util/gparams.h"
+#include "bench_util.h"
+
+//
+// z3-bench: in-process microbenchmarks for hot kernels.
+// Each module runs with warmup and repetition and reports
+// mean/stddev/min/max, see bench_util.h.
+//
+
+#define BENCH(MODULE) {                                      \
+        void bnc_##MODULE();                                 \
+        if (do_display_usage)                                \
+            std::cout << "    " << #MODULE << "\n";          \
+        for (int i = 0; i < argc; i++)                       \
+            if (bench_all || strcmp(argv[i], #MODULE) == 0)  \
+                bnc_##MODULE();                              \
+    }
+
+static void error(const char * msg) {
+    std::cerr << "Error: " << msg << "\n";
+    std::cerr << "For usage information: z3-bench /h\n";
+    exit(1);
+}
+
+static void display_usage() {
+    std::cout << "Z3 microbenchmarks. (C) Copyright 2026 Microsoft Corp.\n";
+    std::cout << "Usage: z3-bench [options] [module names]\n";
+    std::cout << "\nMisc.:\n";
+    std::cout << "  /h          prints this message.\n";
+    std::cout << "  /v:level    be verbose, where <level> is the verbosity level.\n";
+    std::cout << "  /a          run all benchmarks.\n";
+    std::cout << "  /rep:n      number of measured repetitions per benchmark (default 5).\n";
+    std::cout << "  /warmup:n   number of discarded warmup rounds per benchmark (default 2).\n";
+    std::cout << "\nModule names:\n";
+}
+
+static void parse_cmd_line_args(int argc, char ** argv, bool& do_display_usage, bool& bench_all) {
+    int i = 1;
+    if (argc == 1) {
+        display_usage();
+        do_display_usage = true;
+    }
+    while (i < argc) {
+        char * arg = argv[i];
+        char * eq_pos = nullptr;
+
+        if (arg[0] == '-' || arg[0] == '/') {
+            char * opt_name = arg + 1;
+            char * opt_arg  = nullptr;
+            char * colon    = strchr(arg, ':');
+            if (colon) {
+                opt_arg = colon + 1;
+                *colon  = 0;
+            }
+            if (strcmp(opt_name, "h") == 0 ||
+                strcmp(opt_name, "?") == 0) {
+                display_usage();
+                do_display_usage = true;
+                return;
+            }
+            else if (strcmp(opt_name, "v") == 0) {
+                if (!opt_arg)
+                    error("option argument (/v:level) is missing.");
+                long lvl = strtol(opt_arg, nullptr, 10);
+                set_verbosity_level(lvl);
+            }
+            else if (strcmp(opt_name, "a") == 0) {
+                bench_all = true;
+            }
+            else if (strcmp(opt_name, "rep") == 0) {
+                if (!opt_arg)
+                    error("option argument (/rep:n) is missing.");
+                bench::get_config().m_repetitions = std::max(1l, strtol(opt_arg, nullptr, 10));
+            }
+            else if (strcmp(opt_name, "warmup") == 0) {
+                if (!opt_arg)
+                    error("option argument (/warmup:n) is missing.");
+                bench::get_config().m_warmup = strtol(opt_arg, nullptr, 10);
+            }
+        }
+        else if (arg[0] != '"' && (eq_pos = strchr(arg, '='))) {
+            char * key   = arg;
+            *eq_pos      = 0;
+            char * value = eq_pos+1;
+            try {
+                gparams::set(key, value);
+            }
+            catch (z3_exception& ex) {
+                std::cerr << ex.what() << "\n";
+            }
+        }
+        i++;
+    }
+}
+
+int main(int argc, char ** argv) {
+    memory::initialize(0);
+    bool do_display_usage = false;
+    bool bench_all = false;
+    parse_cmd_line_args(argc, argv, do_display_usage, bench_all);
+    BENCH(sat_propagate);
+    BENCH(rewriter);
+    BENCH(lar_solver);
+    BENCH(egraph_merge);
+    BENCH(parse_smt2);
+    return 0;
+}
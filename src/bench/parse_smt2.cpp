@@ -0,0 +1,34 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Abstract:
+
+    Benchmark SMT-LIB2 parse throughput on a synthesized benchmark with
+    thousands of declarations and arithmetic assertions.
+
+--*/
+
+#include <sstream>
+#include "util/util.h"
+#include "cmd_context/cmd_context.h"
+#include "parsers/smt2/smt2parser.h"
+#include "bench_util.h"
+
+void bnc_parse_smt2() {
+    std::ostringstream b;
+    unsigned N = 2000;
+    for (unsigned i = 0; i < N; ++i)
+        b << "(declare-const x" << i << " Int)\n";
+    for (unsigned i = 0; i < N; ++i)
+        b << "(assert (<= (+ (* 3 x" << i << ") x" << (i + 1) % N
+          << " (- x" << (i + 2) % N << ")) " << i << "))\n";
+    std::string text = b.str();
+
+    bench::run("parse_smt2", [&]() {
+        ast_manager m;
+        cmd_context ctx(false, &m);
+        ctx.set_ignore_check(true);
+        std::istringstream is(text);
+        VERIFY(parse_smt2_commands(ctx, is));
+    });
+}
@@ -0,0 +1,50 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    ast_binary_cmds.cpp
+
+Abstract:
+    SMT2 front-end commands for saving and loading assertions
+    in the binary AST format.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+Notes:
+
+--*/
+#include<fstream>
+#include "ast/ast_binary.h"
+#include "cmd_context/cmd_context.h"
+#include "cmd_context/cmd_util.h"
+
+UNARY_CMD(save_assertions_binary_cmd, "save-assertions-binary", "<string>",
+          "save the current assertions to a file in binary AST format", CPK_STRING, char const *, {
+    std::ofstream out(arg, std::ios::binary);
+    if (!out)
+        throw cmd_exception("failed to open file for writing");
+    ptr_vector<expr> const & asms = ctx.assertions();
+    serialize_ast_dag(out, ctx.m(), asms.size(), asms.data());
+});
+
+UNARY_CMD(load_assertions_binary_cmd, "load-assertions-binary", "<string>",
+          "load assertions from a file in binary AST format", CPK_STRING, char const *, {
+    std::ifstream in(arg, std::ios::binary);
+    if (!in)
+        throw cmd_exception("failed to open file for reading");
+    expr_ref_vector roots(ctx.m());
+    deserialize_ast_dag(in, ctx.m(), roots);
+    for (expr * e : roots) {
+        if (!ctx.m().is_bool(e))
+            throw cmd_exception("binary AST stream contains a non-Boolean assertion");
+        ctx.assert_expr(e);
+    }
+});
+
+void install_ast_binary_cmds(cmd_context & ctx) {
+    ctx.insert(alloc(save_assertions_binary_cmd));
+    ctx.insert(alloc(load_assertions_binary_cmd));
+}
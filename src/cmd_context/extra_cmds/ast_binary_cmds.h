@@ -0,0 +1,23 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    ast_binary_cmds.h
+
+Abstract:
+    SMT2 front-end commands for saving and loading assertions
+    in the binary AST format.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+Notes:
+
+--*/
+#pragma once
+
+class cmd_context;
+
+void install_ast_binary_cmds(cmd_context & ctx);
@@ -264,6 +264,7 @@ namespace dd {
     pdd_manager::PDD pdd_manager::apply(PDD arg1, PDD arg2, pdd_op op) {
         unsigned count = 0;
         SASSERT(well_formed());
+        try_gc_op_cache();
         scoped_push _sp(*this);
         while (true) {
             try {
@@ -280,12 +281,13 @@ namespace dd {
         return null_pdd;
     }
 
-    bool pdd_manager::check_result(op_entry*& e1, op_entry const* e2, PDD a, PDD b, PDD c) {
+    bool pdd_manager::check_result(op_entry*& e1, op_entry* e2, PDD a, PDD b, PDD c) {
         if (e1 != e2) {
             SASSERT(e2->m_result != null_pdd);
+            e2->m_gen = m_op_cache_gen;
             push_entry(e1);
             e1 = nullptr;
-            return true;            
+            return true;
         }
         else {
             e1->m_pdd1 = a;
@@ -343,7 +345,7 @@ namespace dd {
         }
 
         op_entry * e1 = pop_entry(p, q, op);
-        op_entry const* e2 = m_op_cache.insert_if_not_there(e1);
+        op_entry* e2 = m_op_cache.insert_if_not_there(e1);
         if (check_result(e1, e2, p, q, op)) {
             SASSERT(!m_free_nodes.contains(e2->m_result));
             return e2->m_result;
@@ -526,6 +528,7 @@ namespace dd {
         }
         unsigned count = 0;
         SASSERT(well_formed());
+        try_gc_op_cache();
         scoped_push _sp(*this);
         while (true) {
             try {
@@ -547,7 +550,7 @@ namespace dd {
         if (is_zero(a)) return zero_pdd;
         if (is_val(a)) return imk_val(-val(a));
         op_entry* e1 = pop_entry(a, a, pdd_minus_op);
-        op_entry const* e2 = m_op_cache.insert_if_not_there(e1);
+        op_entry* e2 = m_op_cache.insert_if_not_there(e1);
         if (check_result(e1, e2, a, a, pdd_minus_op)) 
             return e2->m_result;
         push(minus_rec(lo(a)));
@@ -585,6 +588,7 @@ namespace dd {
         SASSERT(c.is_int());
         unsigned count = 0;
         SASSERT(well_formed());
+        try_gc_op_cache();
         scoped_push _sp(*this);
         while (true) {
             try {
@@ -619,7 +623,7 @@ namespace dd {
         if (c_pdd == null_pdd)
             c_pdd = imk_val(c);
         op_entry* e1 = pop_entry(a, c_pdd, pdd_div_const_op);
-        op_entry const* e2 = m_op_cache.insert_if_not_there(e1);
+        op_entry* e2 = m_op_cache.insert_if_not_there(e1);
         if (check_result(e1, e2, a, c_pdd, pdd_div_const_op))
             return e2->m_result;
         push(div_rec(lo(a), c, c_pdd));
@@ -1300,6 +1304,7 @@ namespace dd {
             result = new (mem) op_entry(l, r, op);
         }
         result->m_result = null_pdd;
+        result->m_gen = m_op_cache_gen;
         return result;
     }
 
@@ -1396,12 +1401,40 @@ namespace dd {
     }
 
     void pdd_manager::try_gc() {
-        gc();        
+        gc();
         reset_op_cache();
         SASSERT(m_op_cache.empty());
         SASSERT(well_formed());
     }
 
+    void pdd_manager::try_gc_op_cache() {
+        if (m_op_cache.size() > m_op_cache_watermark)
+            gc_op_cache();
+    }
+
+    // Generational eviction of the operation cache: entries that were neither
+    // created nor hit since the previous sweep are discarded. Entries whose
+    // result is still being computed are kept. If most entries survive, the
+    // cache is hot and the watermark is doubled so sweeps stay amortized.
+    void pdd_manager::gc_op_cache() {
+        IF_VERBOSE(13, verbose_stream() << "(pdd :gc-op-cache " << m_op_cache.size() << ")\n";);
+        ptr_vector<op_entry> to_delete, to_keep;
+        for (auto* e : m_op_cache) {
+            if (e->m_result != null_pdd && e->m_gen != m_op_cache_gen)
+                to_delete.push_back(e);
+            else
+                to_keep.push_back(e);
+        }
+        m_op_cache.reset();
+        for (op_entry* e : to_delete)
+            m_alloc.deallocate(sizeof(*e), e);
+        for (op_entry* e : to_keep)
+            m_op_cache.insert(e);
+        ++m_op_cache_gen;
+        if (m_op_cache.size() * 2 > m_op_cache_watermark)
+            m_op_cache_watermark *= 2;
+    }
+
     void pdd_manager::reserve_var(unsigned i) {
         while (m_var2level.size() <= i) {
             unsigned v = m_var2level.size();
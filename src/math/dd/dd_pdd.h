@@ -127,13 +127,15 @@ namespace dd {
                 m_pdd1(l),
                 m_pdd2(r),
                 m_op(op),
-                m_result(0)
+                m_result(0),
+                m_gen(0)
             {}
 
             PDD      m_pdd1;
             PDD      m_pdd2;
             PDD      m_op;
             PDD      m_result;
+            unsigned m_gen; // generation of creation or last hit; stale entries are evicted
             unsigned hash() const { return mk_mix(m_pdd1, m_pdd2, m_op); }
         };
 
@@ -191,6 +193,8 @@ namespace dd {
         mpq_table                  m_mpq_table;
         svector<PDD>               m_pdd_stack;
         op_entry*                  m_spare_entry;
+        unsigned                   m_op_cache_gen = 0;
+        unsigned                   m_op_cache_watermark = 1 << 16;
         svector<PDD>               m_var2pdd;
         unsigned_vector            m_var2level, m_level2var;
         unsigned_vector            m_free_nodes;
@@ -241,8 +245,10 @@ namespace dd {
 
         op_entry* pop_entry(PDD l, PDD r, PDD op);
         void push_entry(op_entry* e);
-        bool check_result(op_entry*& e1, op_entry const* e2, PDD a, PDD b, PDD c);
-        
+        bool check_result(op_entry*& e1, op_entry* e2, PDD a, PDD b, PDD c);
+        void try_gc_op_cache();
+        void gc_op_cache();
+
         void alloc_free_nodes(unsigned n);
         void init_mark();
         void set_mark(unsigned i) { m_mark[i] = m_mark_level; }
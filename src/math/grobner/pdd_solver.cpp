@@ -319,23 +319,28 @@ namespace dd {
     }
 
     solver::equation* solver::pick_next() {
-        while (m_levelp1 > 0) {
-            unsigned v = m_level2var[m_levelp1-1];
-            equation* eq = nullptr;
-            for (equation* curr : m_to_simplify) {
-                SASSERT(curr->idx() != UINT_MAX);
-                pdd const& p = curr->poly();
-                if (curr->state() == to_simplify && p.var() == v) {
-                    if (!eq || is_simpler(*curr, *eq))
-                        eq = curr;
-                }
-            }
-            if (eq) {
-                pop_equation(eq);
-                return eq;
+        // Single pass over the work queue: select the equation whose leading
+        // variable has the highest level, breaking ties with is_simpler.
+        // This is equivalent to scanning the levels from m_levelp1 downwards,
+        // but avoids re-traversing m_to_simplify once per empty level.
+        equation* eq = nullptr;
+        unsigned eq_level = 0;
+        for (equation* curr : m_to_simplify) {
+            SASSERT(curr->idx() != UINT_MAX);
+            if (curr->state() != to_simplify)
+                continue;
+            unsigned l = m_var2level[curr->poly().var()];
+            if (!eq || l > eq_level || (l == eq_level && is_simpler(*curr, *eq))) {
+                eq = curr;
+                eq_level = l;
             }
-            --m_levelp1;
         }
+        if (eq) {
+            m_levelp1 = eq_level + 1;
+            pop_equation(eq);
+            return eq;
+        }
+        m_levelp1 = 0;
         return nullptr;
     }
 
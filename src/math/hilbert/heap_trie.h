@@ -182,6 +182,8 @@ class heap_trie {
     stats    m_stats;
     node*    m_spare_leaf;
     node*    m_spare_trie;
+    vector<Key>      m_last_keys;  // path of the last insertion, reused by
+    ptr_vector<node> m_last_path;  // subsequent insertions sharing a key prefix
 
 public:
 
@@ -217,11 +219,36 @@ public:
         m_root = mk_trie();
         m_spare_trie = mk_trie();
         m_spare_leaf = mk_leaf();
+        m_last_keys.reset();
+        m_last_path.reset();
     }
 
     void insert(Key const* keys, Value const& val) {
         ++m_stats.m_num_inserts;
-        insert(m_root, num_keys(), keys, m_keys.data(), val);
+        node* n = m_root;
+        unsigned i = 0;
+        // Batched insertions, such as re-indexing a sorted basis, mostly
+        // agree on a prefix of keys. Reuse the path of the last insertion
+        // for the shared prefix instead of scanning the children at each
+        // level. Nodes are not deallocated before a reset, so the cached
+        // path stays valid across removals.
+        while (i < m_last_path.size() && get_key(keys, i) == m_last_keys[i]) {
+            n->inc_ref();
+            n = m_last_path[i];
+            ++i;
+        }
+        m_last_keys.shrink(i);
+        m_last_path.shrink(i);
+        for (; i < num_keys(); ++i) {
+            n->inc_ref();
+            Key const& key = get_key(keys, i);
+            n = insert_key(to_trie(n), (i + 1 == num_keys()), key);
+            m_last_keys.push_back(key);
+            m_last_path.push_back(n);
+        }
+        n->inc_ref();
+        to_leaf(n)->set_value(val);
+        SASSERT(n->ref_count() == 1);
 #if 0
         if (m_stats.m_num_inserts == (1 << m_do_reshuffle)) {
             m_do_reshuffle++;
@@ -532,6 +559,8 @@ private:
         }
         del_node(m_root);
         m_root = new_root;
+        m_last_keys.reset();
+        m_last_path.reset();
         for (unsigned i = 0; i < m_keys.size(); ++i) {
             m_keys[i] = new_keys[i];
         }
@@ -911,10 +911,14 @@ lbool hilbert_basis::saturate(num_vector const& ineq, bool is_eq) {
     for (unsigned i = 0; i < m_basis.size(); ++i) {
         offset_t idx = m_basis[i];
         values v = vec(idx);
-        v.weight() = get_weight(v, ineq);
-        for (unsigned k = 0; k < m_current_ineq; ++k) {
-            v.weight(k) = get_weight(v, m_ineqs[k]);        
+        if (m_current_ineq > 0) {
+            // the previous round left the weight of m_ineqs[m_current_ineq-1]
+            // in the scratch slot. Move it into its dedicated slot. The weights
+            // of the older inequalities are maintained by resolve and by the
+            // earlier rounds, so they need not be recomputed.
+            v.weight(m_current_ineq - 1) = v.weight();
         }
+        v.weight() = get_weight(v, ineq);
         m_index->insert(idx, v);
         if (v.weight().is_zero()) {
             m_zero.push_back(idx);
@@ -31,6 +31,7 @@ namespace lp {
     template <typename C, typename B> // C plays a role of a container, B - lp_bound_propagator
     class bound_analyzer_on_row {
         const C&                           m_row;
+        unsigned                           m_row_index;
         B &                                m_bp;
         int                                m_column_of_u; // index of an unlimited from above monoid
         // -1 means that such a value is not found, -2 means that at least two of such monoids were found
@@ -41,21 +42,24 @@ namespace lp {
         // constructor
         bound_analyzer_on_row(
             const C & it,
+            unsigned row_index,
             const numeric_pair<mpq>& rs,
             B & bp)
             :
             m_row(it),
+            m_row_index(row_index),
             m_bp(bp),
             m_column_of_u(-1),
             m_column_of_l(-1),
             m_rs(rs)
             {}
 
-    
+
         static unsigned analyze_row(const C & row,
+                                    unsigned row_index,
                                     const numeric_pair<mpq>& rs,
                                     B & bp) {
-            bound_analyzer_on_row a(row, rs, bp);
+            bound_analyzer_on_row a(row, row_index, rs, bp);
             return a.analyze();
         }
 
@@ -297,8 +301,13 @@ namespace lp {
 
         void limit_j(unsigned bound_j, const mpq& u, bool coeff_before_j_is_pos, bool is_lower_bound, bool strict) {
             auto* lar = &m_bp.lp();
-            const auto& row = this->m_row;
-            auto explain = [row, bound_j, coeff_before_j_is_pos, is_lower_bound, strict, lar]() {
+            // Record only the row index: most implied bounds are never asserted,
+            // so copying the row into the closure was wasted work. The closure is
+            // only valid while the tableau is not re-pivoted; all consumers
+            // materialize the explanation in the same propagation pass.
+            unsigned row_index = m_row_index;
+            auto explain = [row_index, bound_j, coeff_before_j_is_pos, is_lower_bound, strict, lar]() {
+                const auto& row = lar->get_row(row_index);
                 (void) strict;
                 TRACE(bound_analyzer, tout << "explain_bound_on_var_on_coeff, bound_j = " << bound_j << ", coeff_before_j_is_pos = " << coeff_before_j_is_pos << ", is_lower_bound = " << is_lower_bound << ", strict = " << strict << "\n";);
                 int bound_sign = (is_lower_bound ? 1 : -1);
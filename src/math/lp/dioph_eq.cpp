@@ -1490,10 +1490,12 @@ namespace lp {
         }
 
         lia_move tighten_terms_with_S() {
-            // Copy changed terms to another vector for sorting
-            std_vector<unsigned> sorted_changed_terms;
+            // Copy changed terms, paired with their weights, to another vector for sorting.
+            // term_weight is linear in the term size, so compute it once per term
+            // instead of inside the sort comparator.
+            std_vector<std::pair<unsigned, unsigned>> sorted_changed_terms; // (weight, term column)
             std_vector<unsigned> processed_terms;
-            for (unsigned j: m_terms_to_tighten) {                
+            for (unsigned j: m_terms_to_tighten) {
                 if (j >= lra.column_count() ||
                     !lra.column_has_term(j) ||
                     lra.column_is_free(j) ||
@@ -1501,24 +1503,24 @@ namespace lp {
                     processed_terms.push_back(j);
                     continue;
                 }
-                sorted_changed_terms.push_back(j);
+                sorted_changed_terms.push_back({term_weight(lra.get_term(j)), j});
             }
 
             // Sort by term_weight descending
             std::sort(sorted_changed_terms.begin(), sorted_changed_terms.end(),
-                      [this](unsigned j1, unsigned j2) {
-                          return term_weight(lra.get_term(j1)) > term_weight(lra.get_term(j2) );
+                      [](std::pair<unsigned, unsigned> const& p1, std::pair<unsigned, unsigned> const& p2) {
+                          return p1.first > p2.first;
                       });
-        
+
             lia_move r = lia_move::undef;
             // Process sorted terms
             TRACE(dio, 
-                  tout << "changed terms:"; for (auto j : sorted_changed_terms) tout << j << " "; tout << std::endl;
+                  tout << "changed terms:"; for (auto const& [w, j] : sorted_changed_terms) tout << j << " "; tout << std::endl;
                   print_S(tout);
                   // lra.display(tout);
                   // print_bounds(tout);
             );
-            for (unsigned j : sorted_changed_terms) {
+            for (auto const& [w, j] : sorted_changed_terms) {
                 if (is_big_term_or_no_term(j)) {
                     m_terms_to_tighten.remove(j);
                     continue;
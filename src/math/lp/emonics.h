@@ -59,7 +59,11 @@ class emonics {
         hash_canonical(emonics& em): em(em) {}
             
         unsigned operator()(lpvar v) const {
-            auto const& vec = v != UINT_MAX? em.m_monics[em.m_var2index[v]].rvars() : em.m_find_key;
+            // monics carry the hash of their canonized variables, so only
+            // probes through m_find_key have to hash an exponent vector.
+            if (v != UINT_MAX)
+                return em.m_monics[em.m_var2index[v]].rhash();
+            auto const& vec = em.m_find_key;
             return string_hash(reinterpret_cast<char const*>(vec.data()), sizeof(lpvar)*vec.size(), 10);
         }
     };
@@ -490,8 +490,24 @@ public:
             return all_of(t, [&](auto ci) { return ci.coeff().is_small(); });
         };
         auto add_cut = [&](const lar_term& t, const mpq& k, u_dependency * dep) {
+            // In incremental runs the same cut is frequently re-derived after
+            // backtracking while its term column is still alive. Reuse the
+            // normalized-term registry to detect this and strengthen the bound
+            // of the existing column instead of growing the tableau with a
+            // duplicate row.
+            mpq a;
+            lar_term norm_t = t.get_normalized_by_min_var(a);
+            std::pair<mpq, lpvar> a_j;
+            if (lra.fetch_normalized_term_column(norm_t, a_j)) {
+                mpq c = a / a_j.first; // t == c * (term of column a_j.second)
+                if (c.is_pos())
+                    lra.update_column_type_and_bound(a_j.second, lp::lconstraint_kind::GE, k / c, dep);
+                else
+                    lra.update_column_type_and_bound(a_j.second, lp::lconstraint_kind::LE, k / c, dep);
+                return;
+            }
             lp::lpvar j = lra.add_term(t.coeffs_as_vector(), UINT_MAX);
-            lra.update_column_type_and_bound(j, lp::lconstraint_kind::GE,  k, dep); 
+            lra.update_column_type_and_bound(j, lp::lconstraint_kind::GE,  k, dep);
         };
         auto _check_feasible = [&](void) {
             lra.find_feasible_solution();
@@ -559,5 +575,8 @@ public:
     }
     
     
-    gomory::gomory(int_solver& lia): lia(lia), lra(lia.lra) { }
+    gomory::gomory(int_solver& lia): lia(lia), lra(lia.lra) {
+        // cut deduplication in add_cut relies on the normalized-term registry.
+        lra.register_existing_terms();
+    }
 }
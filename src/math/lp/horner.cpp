@@ -82,10 +82,12 @@ bool horner::lemmas_on_row(const T& row) {
     c().set_active_vars_weights(m_nex_creator); // without this call the comparisons will be incorrect
     nex* e =  m_nex_creator.simplify(m_row_sum.mk());
     TRACE(nla_horner, tout << "e = " << * e << "\n";);
-    if (e->get_degree() < 2)
-        return false;
-    if (!e->is_sum())
+    if (e->get_degree() < 2 || !e->is_sum()) {
+        // reclaim the nodes created for the row; otherwise they stay
+        // allocated until the next cross_nested is destructed.
+        m_nex_creator.clear();
         return false;
+    }
     
     cross_nested cn(
         [this, dep](const nex* n) { return c().m_intervals.check_nex(n, dep); },
@@ -105,17 +107,22 @@ bool horner::horner_lemmas() {
     c().lp_settings().stats().m_horner_calls++;
     const auto& matrix = c().lra.A_r();
     // choose only rows that depend on m_to_refine variables
-    std::set<unsigned> rows_to_check;
+    indexed_uint_set rows_to_check;
     for (lpvar j : c().m_to_refine) {
         for (auto & s : matrix.m_columns[j])
             rows_to_check.insert(s.var());
     }
     c().clear_active_var_set();
     svector<unsigned> rows;
-    for (unsigned i : rows_to_check) {
+    for (unsigned i : rows_to_check)
+        rows.push_back(i);
+    std::sort(rows.begin(), rows.end());
+    unsigned k = 0;
+    for (unsigned i : rows) {
         if (row_is_interesting(matrix.m_rows[i]))
-            rows.push_back(i);
+            rows[k++] = i;
     }
+    rows.shrink(k);
 
     unsigned r = c().random();
     unsigned sz = rows.size();
@@ -82,33 +82,7 @@ namespace lp {
     }
 
     impq int_cube::get_cube_delta_for_term(const lar_term& t) const {
-        if (t.size() == 2) {
-            bool seen_minus = false;
-            bool seen_plus = false;
-            for(lar_term::ival p : t) {
-                if (!lia.column_is_int(p.j()))
-                    goto usual_delta;
-                const mpq & c = p.coeff();
-                if (c == one_of_type<mpq>()) {
-                    seen_plus = true;
-                } else if (c == -one_of_type<mpq>()) {
-                    seen_minus = true;
-                } else {
-                    goto usual_delta;
-                }
-            }
-            if (seen_minus && seen_plus)
-                return zero_of_type<impq>();
-            return impq(0, 1);
-        }
-    usual_delta:
-        mpq delta = zero_of_type<mpq>();
-        for (lar_term::ival p : t)
-            if (lia.column_is_int(p.j()))
-                delta += abs(p.coeff());
-        
-        delta *= mpq(1, 2);
-        return impq(delta);
+        return lia.cube_delta_for_term(t);
     }
 
 }
@@ -10,6 +10,7 @@
 #include "math/lp/int_branch.h"
 #include "math/lp/int_cube.h"
 #include "math/lp/dioph_eq.h"
+#include "util/map.h"
 
 namespace lp {
     bool get_patching_deltas(const rational& x, const rational& alpha,
@@ -44,7 +45,11 @@ namespace lp {
         dioph_eq            m_dio;  
         int_gcd_test        m_gcd;
         unsigned            m_initial_dio_calls_period;
-        
+        // Cube deltas depend only on the term structure and on column
+        // integrality, so they stay valid until the set of terms changes.
+        unsigned            m_cube_delta_epoch = UINT_MAX;
+        u_map<impq>         m_cube_deltas;
+
         bool column_is_int_inf(unsigned j) const {
             return lra.column_is_int(j) && (!lia.value_is_int(j));
         }
@@ -191,7 +196,49 @@ namespace lp {
         }
 
         lp_settings& settings() { return lra.settings(); }
-        
+
+        impq compute_cube_delta(const lar_term& t) const {
+            if (t.size() == 2) {
+                bool seen_minus = false;
+                bool seen_plus = false;
+                for (lar_term::ival p : t) {
+                    if (!lia.column_is_int(p.j()))
+                        goto usual_delta;
+                    const mpq & c = p.coeff();
+                    if (c == one_of_type<mpq>())
+                        seen_plus = true;
+                    else if (c == -one_of_type<mpq>())
+                        seen_minus = true;
+                    else
+                        goto usual_delta;
+                }
+                if (seen_minus && seen_plus)
+                    return zero_of_type<impq>();
+                return impq(0, 1);
+            }
+        usual_delta:
+            mpq delta = zero_of_type<mpq>();
+            for (lar_term::ival p : t)
+                if (lia.column_is_int(p.j()))
+                    delta += abs(p.coeff());
+
+            delta *= mpq(1, 2);
+            return impq(delta);
+        }
+
+        impq cube_delta_for_term(const lar_term& t) {
+            if (m_cube_delta_epoch != lra.term_epoch()) {
+                m_cube_deltas.reset();
+                m_cube_delta_epoch = lra.term_epoch();
+            }
+            impq delta;
+            if (m_cube_deltas.find(t.j(), delta))
+                return delta;
+            delta = compute_cube_delta(t);
+            m_cube_deltas.insert(t.j(), delta);
+            return delta;
+        }
+
         bool should_find_cube() {
             return m_number_of_calls % settings().m_int_find_cube_period == 0;
         }
@@ -446,6 +493,10 @@ namespace lp {
         return m_imp->check(e);
     }
 
+    impq int_solver::cube_delta_for_term(const lar_term& t) {
+        return m_imp->cube_delta_for_term(t);
+    }
+
     
     std::ostream& int_solver::display_inf_rows(std::ostream& out) const {
         unsigned num = lra.A_r().column_count();
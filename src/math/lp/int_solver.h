@@ -66,6 +66,7 @@ public:
     ~int_solver();
     // the function that doing the main job
     lia_move check(explanation *);
+    impq cube_delta_for_term(const lar_term& t);
     lar_term const& get_term() const;
     lar_term & get_term();
     mpq const& offset() const;
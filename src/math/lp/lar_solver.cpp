@@ -554,6 +554,7 @@ namespace lp {
 
     void lar_solver::pop(unsigned k) {
         TRACE(lar_solver, tout << "k = " << k << std::endl;);
+        m_term_epoch++;
         m_imp->m_crossed_bounds_column = null_lpvar;
         m_imp->m_crossed_bounds_deps = nullptr;
         m_imp->m_trail.pop_scope(k);
@@ -2026,6 +2027,7 @@ namespace lp {
         lar_term* t = new lar_term(coeffs);
         subst_known_terms(t);
         SASSERT (!t->is_empty());
+        m_term_epoch++;
         m_imp->m_terms.push_back(t);
         lpvar ret = A_r().column_count();
         add_row_from_term_no_constraint(t, ext_i);
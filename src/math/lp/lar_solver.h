@@ -116,6 +116,7 @@ class lar_solver : public column_namer {
 
         return bound_analyzer_on_row<row_strip<mpq>, lp_bound_propagator<T>>::analyze_row(
             A_r().m_rows[row_index],
+            row_index,
             zero_of_type<numeric_pair<mpq>>(),
             bp);
     }
@@ -312,7 +313,11 @@ public:
     
     public:
     std::function<void (const lar_term*)> m_add_term_callback;
-    std::function<void (unsigned)> m_update_column_bound_callback;  
+    std::function<void (unsigned)> m_update_column_bound_callback;
+    // bumped whenever the set of terms changes (add_term/pop);
+    // lets clients cache data derived from term structure between rounds.
+    unsigned m_term_epoch = 0;
+    unsigned term_epoch() const { return m_term_epoch; }
     bool external_is_used(unsigned) const;
     void pop(unsigned k);
     trail_stack& trail();
@@ -109,6 +109,7 @@ namespace lp_api {
         unsigned m_assume_eqs;
         unsigned m_branch;
         unsigned m_bv_axioms;
+        unsigned m_shared_terms;
         stats() { reset(); }
         void reset() {
             memset(this, 0, sizeof(*this));
@@ -130,6 +131,7 @@ namespace lp_api {
             st.update("arith-assume-eqs", m_assume_eqs);
             st.update("arith-branch", m_branch);
             st.update("arith-bv-axioms", m_bv_axioms);
+            st.update("arith-shared-terms", m_shared_terms);
         }
     };
 
@@ -56,6 +56,7 @@ protected:
 class monic: public mon_eq {
     // fields
     svector<lpvar>   m_rvars;
+    unsigned         m_rhash = 0; // hash of m_rvars, refreshed by sort_rvars
     bool             m_rsign;
     mutable unsigned m_visited;
     bool             m_propagated = false;
@@ -72,10 +73,14 @@ public:
     unsigned visited() const { return m_visited; }
     void set_visited(unsigned v) { m_visited = v; }
     svector<lpvar> const& rvars() const { return m_rvars; }
+    unsigned rhash() const { return m_rhash; }
     bool rsign() const { return m_rsign; }
     void reset_rfields() { m_rsign = false; m_rvars.reset(); SASSERT(m_rvars.size() == 0); }
     void push_rvar(signed_var sv) { m_rsign ^= sv.sign(); m_rvars.push_back(sv.var()); }
-    void sort_rvars() { std::sort(m_rvars.begin(), m_rvars.end()); }
+    void sort_rvars() {
+        std::sort(m_rvars.begin(), m_rvars.end());
+        m_rhash = string_hash(reinterpret_cast<char const*>(m_rvars.data()), sizeof(lpvar)*m_rvars.size(), 10);
+    }
     void set_propagated(bool p) { m_propagated = p; }
     bool is_propagated() const { return m_propagated; }
     void set_bound_propagated(bool p) { m_bound_propagated = p; }
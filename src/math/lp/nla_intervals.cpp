@@ -314,14 +314,15 @@ bool intervals::interval_of_sum_no_term(const nex_sum& e, scoped_dep_interval &
     
     if (!interval_of_expr<wd>(e[0], 1, sdi, f))
         return false;
+    // reuse the temporaries across summands; every path through
+    // interval_of_expr and add assigns all fields of its target.
+    scoped_dep_interval b(get_dep_intervals());
+    scoped_dep_interval c(get_dep_intervals());
     for (unsigned k = 1; k < e.size(); k++) {
         TRACE(nla_intervals_details, tout << "e[" << k << "]= " << *e[k] << "\n";);
-        scoped_dep_interval  b(get_dep_intervals());
         if (!interval_of_expr<wd>(e[k], 1, b, f)) {
             return false;
         }
-        scoped_dep_interval  c(get_dep_intervals());
-
         TRACE(nla_intervals_details, tout << "sdi = "; display(tout, sdi) << "\nb = "; display(tout, b) << "\n";);
         m_dep_intervals.add<wd>(sdi, b, c);        
         m_dep_intervals.set<wd>(sdi, c);
@@ -409,12 +410,12 @@ bool intervals::interval_of_mul(const nex_mul& e, scoped_dep_interval& a, const
 
     m_dep_intervals.set_interval_for_scalar(a, e.coeff());
     TRACE(nla_intervals_details, tout << "a = "; display(tout, a); );
+    scoped_dep_interval b(get_dep_intervals());
+    scoped_dep_interval c(get_dep_intervals());
     for (const auto& ep : e) {
-        scoped_dep_interval b(get_dep_intervals());
         if (!interval_of_expr<wd>(ep.e(), ep.pow(), b, f))
             return false;
         TRACE(nla_intervals_details, tout << "ep = " << ep << ", "; display(tout, b); );
-        scoped_dep_interval c(get_dep_intervals());
         m_dep_intervals.mul<wd>(a, b, c);
         TRACE(nla_intervals_details, tout << "a "; display(tout, a););
         TRACE(nla_intervals_details, tout << "c "; display(tout, c););
@@ -19,6 +19,7 @@
   --*/
 #pragma once
 
+#include "util/machine.h"
 #include "util/vector.h"
 #include <utility>
 #include <set>
@@ -58,8 +59,14 @@ namespace lp {
         remove_element(rowii, rowii[c.offset()]);
         scan_row_strip_to_work_vector(rowii);
         unsigned prev_size_ii = static_cast<unsigned>(rowii.size());
-        // run over the pivot row and update row ii
-        for (const auto & iv : m_rows[i]) {
+        // run over the pivot row and update row ii; the offset lookups scatter
+        // over a vector sized by the column count, so request the next entry's
+        // slot one iteration ahead.
+        auto const & pivot_row = m_rows[i];
+        for (unsigned cell = 0; cell < pivot_row.size(); cell++) {
+            if (cell + 1 < pivot_row.size())
+                machine_prefetch(&m_work_vector_of_row_offsets[pivot_row[cell + 1].var()]);
+            const auto & iv = pivot_row[cell];
             unsigned j = iv.var();
             if (j == pivot_col) continue;
             SASSERT(!is_zero(iv.coeff()));
@@ -127,8 +134,13 @@ namespace lp {
         remove_element(rowii, rowii[c.offset()]);
         scan_row_strip_to_work_vector(rowii);
         unsigned prev_size_ii = static_cast<unsigned>(rowii.size());
-        // run over the pivot row and update row ii
-        for (const auto & iv : m_rows[piv_row_index]) {
+        // run over the pivot row and update row ii; see
+        // pivot_row_to_row_given_cell for the prefetch rationale.
+        auto const & pivot_row = m_rows[piv_row_index];
+        for (unsigned cell = 0; cell < pivot_row.size(); cell++) {
+            if (cell + 1 < pivot_row.size())
+                machine_prefetch(&m_work_vector_of_row_offsets[pivot_row[cell + 1].var()]);
+            const auto & iv = pivot_row[cell];
             unsigned j = iv.var();
             if (j == pivot_col) continue;
             SASSERT(!is_zero(iv.coeff()));
@@ -16,6 +16,7 @@ Author:
 Notes:
 
 --*/
+#include "util/map.h"
 #include "util/mpbq.h"
 #include "util/basic_interval.h"
 #include "util/scoped_ptr_vector.h"
@@ -96,6 +97,22 @@ namespace algebraic_numbers {
         unsigned                 m_compare_refine;
         unsigned                 m_compare_poly_eq;
 
+        /**
+           \brief memo table for isolate_roots, keyed by the coefficient
+           vector of the input polynomial. Clients such as nlsat isolate the
+           roots of the same univariate polynomial repeatedly in sibling
+           branches of the search, and copying the cached cells is much
+           cheaper than re-running isolation. The table is reset wholesale
+           once it grows past ISOLATION_CACHE_LIMIT entries.
+        */
+        struct isolation_entry {
+            upoly           m_up;    // owned copy of the input polynomial
+            numeral_vector  m_roots; // owned copies of the isolated roots
+        };
+        static const unsigned       ISOLATION_CACHE_LIMIT = 1024;
+        ptr_vector<isolation_entry> m_isolation_entries;
+        u_map<unsigned_vector>      m_isolation_table; // coefficient hash -> entry indices
+
         imp(reslimit& lim, manager & w, unsynch_mpq_manager & m, params_ref const & p, small_object_allocator & a):
             m_limit(lim),
             m_wrapper(w),
@@ -121,6 +138,10 @@ namespace algebraic_numbers {
             m_y = pm().mk_var();
         }
 
+        ~imp() {
+            reset_isolation_cache();
+        }
+
         bool acell_inv(algebraic_cell const& c) {
             auto s = upm().eval_sign_at(c.m_p_sz, c.m_p, lower(&c));
             return s == sign_zero || c.m_sign_lower == (s == sign_neg);
@@ -593,6 +614,63 @@ namespace algebraic_numbers {
             }
         }
 
+        unsigned isolation_hash(scoped_upoly const & up) {
+            unsigned r = up.size();
+            for (unsigned i = 0; i < up.size(); i++)
+                r = combine_hash(r, upm().m().hash(up[i]));
+            return r;
+        }
+
+        bool isolation_eq(upoly const & a, scoped_upoly const & b) {
+            if (a.size() != b.size())
+                return false;
+            for (unsigned i = 0; i < a.size(); i++)
+                if (!upm().m().eq(a[i], b[i]))
+                    return false;
+            return true;
+        }
+
+        void reset_isolation_cache() {
+            for (isolation_entry * e : m_isolation_entries) {
+                for (numeral & r : e->m_roots)
+                    del(r);
+                upm().reset(e->m_up);
+                dealloc(e);
+            }
+            m_isolation_entries.reset();
+            m_isolation_table.reset();
+        }
+
+        void cache_isolated_roots(unsigned h, scoped_upoly const & up, numeral_vector const & roots) {
+            if (m_isolation_entries.size() >= ISOLATION_CACHE_LIMIT)
+                reset_isolation_cache();
+            isolation_entry * e = alloc(isolation_entry);
+            upm().set(up.size(), up.data(), e->m_up);
+            for (unsigned i = 0; i < roots.size(); i++) {
+                e->m_roots.push_back(numeral());
+                m_wrapper.set(e->m_roots.back(), roots[i]);
+            }
+            m_isolation_table.insert_if_not_there(h, unsigned_vector()).push_back(m_isolation_entries.size());
+            m_isolation_entries.push_back(e);
+        }
+
+        bool find_isolated_roots(unsigned h, scoped_upoly const & up, numeral_vector & roots) {
+            auto * ce = m_isolation_table.find_core(h);
+            if (!ce)
+                return false;
+            for (unsigned idx : ce->get_data().m_value) {
+                isolation_entry const * e = m_isolation_entries[idx];
+                if (isolation_eq(e->m_up, up)) {
+                    for (numeral const & r : e->m_roots) {
+                        roots.push_back(numeral());
+                        m_wrapper.set(roots.back(), r);
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void sort_roots(numeral_vector & r) {
             if (m_limit.inc()) {
                 // DEBUG_CODE(check_transitivity(r););
@@ -604,6 +682,13 @@ namespace algebraic_numbers {
             TRACE(algebraic, upm().display(tout, up); tout << "\n";);
             if (up.empty())
                 return; // ignore the zero polynomial
+            // the memo is only usable when roots starts out empty:
+            // sort_roots below sorts the whole output vector, so with a
+            // non-empty prefix the cached suffix would not be this call's roots.
+            bool use_cache = roots.empty();
+            unsigned h = isolation_hash(up);
+            if (use_cache && find_isolated_roots(h, up, roots))
+                return;
             factors & fs = m_isolate_factors;
             fs.reset();
             bool full_fact;
@@ -666,6 +751,8 @@ namespace algebraic_numbers {
                 m_isolate_uppers.reset();
             }
             sort_roots(roots);
+            if (use_cache)
+                cache_isolated_roots(h, up, roots);
         }
 
         void isolate_roots(polynomial_ref const & p, numeral_vector & roots) {
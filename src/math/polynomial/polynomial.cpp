@@ -34,6 +34,7 @@ Notes:
 #include "util/ref_buffer.h"
 #include "util/common_msgs.h"
 #include <memory>
+#include <cmath>
 
 namespace polynomial {
 
@@ -6587,6 +6588,137 @@ namespace polynomial {
                 t_eval<numeral_manager>(const_cast<polynomial*>(p), single_var2value(m(),x, val), r);
         }
 
+        /**
+           \brief Collect the coefficients of the univariate polynomial p into the
+           dense array cs, where cs[k] is the coefficient of x^k.
+        */
+        void get_dense_coeffs(polynomial const * p, var x, scoped_numeral_vector & cs, unsigned d) {
+            for (unsigned i = 0; i <= d; i++)
+                cs.push_back(numeral());
+            unsigned sz = p->size();
+            for (unsigned i = 0; i < sz; i++)
+                m().set(cs[p->m(i)->degree_of(x)], p->a(i));
+        }
+
+        /**
+           \brief Return true if d is finite and exactly equal to v.
+        */
+        bool is_exact_double(unsynch_mpq_manager & qm, mpq const & v, double d) {
+            if (!std::isfinite(d))
+                return false;
+            int e;
+            double f = ldexp(frexp(d, &e), 53); // f is integral and d = f * 2^(e-53)
+            e -= 53;
+            scoped_mpq t(qm);
+            scoped_mpz num(qm), den(qm);
+            qm.set(num, static_cast<int64_t>(f));
+            qm.set(den, 1);
+            if (e >= 0)
+                qm.mul2k(num, static_cast<unsigned>(e));
+            else
+                qm.mul2k(den, static_cast<unsigned>(-e));
+            qm.set(t, num, den);
+            return qm.eq(t, v);
+        }
+
+        void multi_eval(polynomial const * p, unsynch_mpq_manager & qm, mpq const * vals, unsigned num_vals, mpq * rs) {
+            SASSERT(is_univariate(p));
+            if (is_zero(p) || is_const(p)) {
+                scoped_mpq c(qm);
+                if (!is_zero(p))
+                    qm.set(c, p->a(0));
+                for (unsigned i = 0; i < num_vals; i++)
+                    qm.set(rs[i], c);
+                return;
+            }
+            var x = max_var(p);
+            unsigned d = 0;
+            for (unsigned i = 0; i < p->size(); i++)
+                d = std::max(d, p->m(i)->degree_of(x));
+            scoped_numeral_vector cs(m());
+            get_dense_coeffs(p, x, cs, d);
+            scoped_mpq r(qm);
+            for (unsigned i = 0; i < num_vals; i++) {
+                checkpoint();
+                qm.set(r, cs[d]);
+                for (unsigned j = d; j-- > 0; ) {
+                    qm.mul(r, vals[i], r);
+                    qm.add(r, cs[j], r);
+                }
+                qm.set(rs[i], r);
+            }
+        }
+
+        void multi_eval_sign(polynomial const * p, unsynch_mpq_manager & qm, mpq const * vals, unsigned num_vals, svector<::sign> & rs) {
+            SASSERT(is_univariate(p));
+            rs.reset();
+            if (is_zero(p) || is_const(p)) {
+                ::sign c = is_zero(p) ? sign_zero : (m().is_pos(p->a(0)) ? sign_pos : sign_neg);
+                for (unsigned i = 0; i < num_vals; i++)
+                    rs.push_back(c);
+                return;
+            }
+            var x = max_var(p);
+            unsigned d = 0;
+            for (unsigned i = 0; i < p->size(); i++)
+                d = std::max(d, p->m(i)->degree_of(x));
+            scoped_numeral_vector cs(m());
+            get_dense_coeffs(p, x, cs, d);
+            // mpz get_double accumulates roughly two rounding errors per 64-bit
+            // limb and returns meaningless finite values for very wide integers,
+            // so the double filter is only used when every coefficient is
+            // narrow. The point conversion needs no such gate: is_exact_double
+            // rejects any value the conversion did not preserve exactly.
+            unsigned max_limbs = 0;
+            for (unsigned j = 0; j <= d; j++)
+                max_limbs = std::max(max_limbs, (m().m().bitsize(cs[j]) + 63) / 64);
+            bool use_double = max_limbs <= 8;
+            svector<double> cds;
+            if (use_double)
+                for (unsigned j = 0; j <= d; j++)
+                    cds.push_back(m().get_double(cs[j]));
+            // Each coefficient conversion is off by at most 2 epsilon per limb
+            // and the Horner recurrence accumulates at most two rounding errors
+            // per step, so 4*limbs + 8(d + 1) epsilon over the magnitude sum is
+            // a comfortable margin.
+            double err_factor = (4.0 * max_limbs + 8.0 * (d + 1)) * std::numeric_limits<double>::epsilon();
+            scoped_mpq r(qm);
+            for (unsigned i = 0; i < num_vals; i++) {
+                checkpoint();
+                double dv = use_double ? qm.get_double(vals[i]) : 0.0;
+                if (use_double && is_exact_double(qm, vals[i], dv)) {
+                    double adv  = std::fabs(dv);
+                    double dr   = cds[d];
+                    double mag  = std::fabs(cds[d]);
+                    for (unsigned j = d; j-- > 0; ) {
+                        dr  = dr * dv + cds[j];
+                        mag = mag * adv + std::fabs(cds[j]);
+                    }
+                    double err = mag * err_factor;
+                    if (std::isfinite(dr) && std::isfinite(mag) && (dr > err || dr < -err)) {
+                        ::sign sg = dr > 0 ? sign_pos : sign_neg;
+                        DEBUG_CODE({
+                            qm.set(r, cs[d]);
+                            for (unsigned j = d; j-- > 0; ) {
+                                qm.mul(r, vals[i], r);
+                                qm.add(r, cs[j], r);
+                            }
+                            SASSERT(sg == (qm.is_pos(r) ? sign_pos : sign_neg));
+                        });
+                        rs.push_back(sg);
+                        continue;
+                    }
+                }
+                // the double filter is inconclusive, evaluate exactly.
+                qm.set(r, cs[d]);
+                for (unsigned j = d; j-- > 0; ) {
+                    qm.mul(r, vals[i], r);
+                    qm.add(r, cs[j], r);
+                }
+                rs.push_back(qm.is_zero(r) ? sign_zero : (qm.is_pos(r) ? sign_pos : sign_neg));
+            }
+        }
+
         void eval(polynomial const * p, var2mpbqi const & x2v, mpbqi & r) {
             t_eval<mpbqi_manager>(const_cast<polynomial*>(p), x2v, r);
         }
@@ -7475,6 +7607,14 @@ namespace polynomial {
         m_imp->exact_pseudo_division_mod_d(p, q, x, x2d, Q, R);
     }
 
+    void manager::multi_eval(polynomial const * p, unsynch_mpq_manager & qm, mpq const * vals, unsigned num_vals, mpq * rs) {
+        m_imp->multi_eval(p, qm, vals, num_vals, rs);
+    }
+
+    void manager::multi_eval_sign(polynomial const * p, unsynch_mpq_manager & qm, mpq const * vals, unsigned num_vals, svector<::sign> & rs) {
+        m_imp->multi_eval_sign(p, qm, vals, num_vals, rs);
+    }
+
     void manager::eval(polynomial const * p, var2mpbqi const & x2v, mpbqi & r) {
         return m_imp->eval(p, x2v, r);
     }
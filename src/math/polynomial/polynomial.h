@@ -952,6 +952,22 @@ namespace polynomial {
         void eval(polynomial const * p, var2mpq const & x2v, mpq & r);
         void eval(polynomial const * p, var2anum const & x2v, algebraic_numbers::anum & r);
 
+        /**
+           \brief Evaluate the univariate polynomial p at the points vals[0], ..., vals[num_vals-1],
+           storing p(vals[i]) in rs[i]. The polynomial is preprocessed once into a dense Horner
+           coefficient array that is shared by all points. qm is the manager that owns the
+           input values and the results.
+        */
+        void multi_eval(polynomial const * p, unsynch_mpq_manager & qm, mpq const * vals, unsigned num_vals, mpq * rs);
+
+        /**
+           \brief Evaluate the sign of the univariate polynomial p at the points
+           vals[0], ..., vals[num_vals-1]. Each point is first evaluated in double
+           precision with a running error bound; exact arithmetic is used only when
+           the double approximation is too close to zero to determine the sign.
+        */
+        void multi_eval_sign(polynomial const * p, unsynch_mpq_manager & qm, mpq const * vals, unsigned num_vals, svector<::sign> & rs);
+
         /**
            \brief Apply substitution [x_1 -> v_1, ..., x_n -> v_n].
            That is, given p \in Z[x_1, ..., x_n, y_1, ..., y_m] return a polynomial
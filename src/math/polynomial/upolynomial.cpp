@@ -744,7 +744,9 @@ namespace upolynomial {
         numeral_vector & v_Zp = m_mgcd_tmp[3];
         numeral_vector & q    = m_mgcd_tmp[4];
         numeral_vector & C    = m_mgcd_tmp[5];
+        numeral_vector & prev = m_mgcd_tmp[6];
 
+        reset(prev);
         for (unsigned i = 0; i < NUM_BIG_PRIMES; i++) {
             m().set(p, polynomial::g_big_primes[i]);
             TRACE(mgcd, tout << "trying prime: " << p << "\n";);
@@ -793,6 +795,14 @@ namespace upolynomial {
             get_primitive(C, candidate);
             TRACE(mgcd, tout << "candidate:\n"; display_star(tout, candidate); tout << "\n";);
             SASSERT(candidate.size() > 0);
+            // the trial divisions below are the expensive part of the loop:
+            // they run over Z on the full-size inputs. Only attempt them once
+            // the primitive part of the combined image is stable under a new
+            // prime; an unstable candidate cannot be the gcd yet.
+            bool stable = eq(candidate, prev);
+            set(candidate.size(), candidate.data(), prev);
+            if (!stable && i + 1 < NUM_BIG_PRIMES)
+                continue;
             numeral const & lc_candidate = candidate[candidate.size() - 1];
             if (m().divides(lc_candidate, lc_g) &&
                 divides(pp_u, candidate) &&
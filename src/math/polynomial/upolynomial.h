@@ -110,7 +110,7 @@ namespace upolynomial {
         numeral_vector    m_gcd_tmp1;
         numeral_vector    m_gcd_tmp2;
         numeral_vector    m_CRA_tmp;
-        #define UPOLYNOMIAL_MGCD_TMPS 6
+        #define UPOLYNOMIAL_MGCD_TMPS 7
         numeral_vector    m_mgcd_tmp[UPOLYNOMIAL_MGCD_TMPS]; 
         numeral_vector    m_sqf_tmp1;
         numeral_vector    m_sqf_tmp2;
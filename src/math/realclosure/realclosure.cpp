@@ -162,7 +162,12 @@ namespace realclosure {
         // To cope with this issue, we cache the value m_interval in m_old_interval whenever the width of m_interval is below
         // a give threshold. Then, after finishing OP, we restore the old_interval.
         mpbqi *  m_old_interval;
-        value(bool rat):m_ref_count(0), m_rational(rat), m_old_interval(nullptr) {}
+        // Tightest interval computed for this value so far. When an operation discards
+        // unnecessary precision (see m_old_interval), the refined interval is remembered
+        // here, so that a subsequent operation needing the same precision does not
+        // refine from scratch.
+        mpbqi *  m_memo_interval;
+        value(bool rat):m_ref_count(0), m_rational(rat), m_old_interval(nullptr), m_memo_interval(nullptr) {}
         bool is_rational() const { return m_rational; }
         mpbqi const & interval() const { return m_interval; }
         mpbqi & interval() { return m_interval; }
@@ -219,8 +224,9 @@ namespace realclosure {
         unsigned m_idx:30;
         mpbqi    m_interval;
         mpbqi *  m_old_interval;
+        mpbqi *  m_memo_interval; //!< Tightest interval computed so far, see value::m_memo_interval.
 
-        extension(kind k, unsigned idx):m_ref_count(0), m_kind(k), m_idx(idx), m_old_interval(nullptr) {}
+        extension(kind k, unsigned idx):m_ref_count(0), m_kind(k), m_idx(idx), m_old_interval(nullptr), m_memo_interval(nullptr) {}
 
         unsigned idx() const { return m_idx; }
         kind knd() const { return static_cast<kind>(m_kind); }
@@ -683,6 +689,47 @@ namespace realclosure {
                 save_interval(x);
         }
 
+        /**
+           \brief Remember the current (refined) interval of v before it is discarded,
+           so that later refinements of v can start from it instead of from scratch.
+           Only the tightest interval seen so far is kept.
+        */
+        template<typename T>
+        void memoize_refined_interval(T * v) {
+            if (contains_zero(v->m_interval))
+                return;
+            int m = magnitude(v->m_interval);
+            if (m == INT_MAX)
+                return;
+            if (v->m_memo_interval == nullptr)
+                v->m_memo_interval = new (allocator()) mpbqi();
+            else if (m != INT_MIN && m >= magnitude(*(v->m_memo_interval)))
+                return; // the memoized interval is at least as tight.
+            set_interval(*(v->m_memo_interval), v->m_interval);
+        }
+
+        /**
+           \brief Reuse a previously memoized refinement of the interval of v.
+           Return true if the memoized interval meets the requested precision;
+           in that case the interval of v is replaced with the memoized one.
+        */
+        template<typename T>
+        bool restore_memo_interval(T * v, unsigned prec) {
+            if (v->m_memo_interval == nullptr || !check_precision(*(v->m_memo_interval), prec))
+                return false;
+            set_interval(v->m_interval, *(v->m_memo_interval));
+            return true;
+        }
+
+        template<typename T>
+        void del_memo_interval(T * v) {
+            if (v->m_memo_interval != nullptr) {
+                bqim().del(*(v->m_memo_interval));
+                allocator().deallocate(sizeof(mpbqi), v->m_memo_interval);
+                v->m_memo_interval = nullptr;
+            }
+        }
+
         /**
            \brief Restore the saved intervals (approximations) of RCF values and extensions
         */
@@ -691,6 +738,7 @@ namespace realclosure {
             unsigned sz = to_restore.size();
             for (unsigned i = 0; i < sz; i++) {
                 T * v = to_restore[i];
+                memoize_refined_interval(v);
                 set_interval(v->m_interval, *(v->m_old_interval));
                 bqim().del(*(v->m_old_interval));
                 allocator().deallocate(sizeof(mpbqi), v->m_old_interval);
@@ -751,12 +799,14 @@ namespace realclosure {
         }
 
         void del_rational(rational_value * v) {
+            del_memo_interval(v);
             bqim().del(v->m_interval);
             qm().del(v->m_value);
             allocator().deallocate(sizeof(rational_value), v);
         }
 
         void del_rational_function(rational_function_value * v) {
+            del_memo_interval(v);
             bqim().del(v->m_interval);
             reset_p(v->num());
             reset_p(v->den());
@@ -821,6 +871,7 @@ namespace realclosure {
         }
 
         void del_algebraic(algebraic * a) {
+            del_memo_interval(a);
             reset_p(a->m_p);
             bqim().del(a->m_interval);
             bqim().del(a->m_iso_interval);
@@ -829,11 +880,13 @@ namespace realclosure {
         }
 
         void del_transcendental(transcendental * t) {
+            del_memo_interval(t);
             bqim().del(t->m_interval);
             allocator().deallocate(sizeof(transcendental), t);
         }
 
         void del_infinitesimal(infinitesimal * i) {
+            del_memo_interval(i);
             bqim().del(i->m_interval);
             allocator().deallocate(sizeof(infinitesimal), i);
         }
@@ -1317,6 +1370,7 @@ namespace realclosure {
         }
 
         void refine_transcendental_interval(transcendental * t, unsigned prec) {
+            restore_memo_interval(t, prec);
             while (!check_precision(t->interval(), prec)) {
                 TRACE(rcf_transcendental, tout << "refine_transcendental_interval: " << magnitude(t->interval()) << std::endl;);
                 checkpoint();
@@ -4409,6 +4463,8 @@ namespace realclosure {
 
         bool refine_algebraic_interval(algebraic * a, unsigned prec) {
             save_interval_if_too_small(a, prec);
+            if (restore_memo_interval(a, prec))
+                return true;
             if (a->sdt() != nullptr) {
                 // We don't bisect the interval, since it contains more than one root.
                 // To bisect this kind of interval we would have to use Tarski queries.
@@ -4489,6 +4545,8 @@ namespace realclosure {
             if (m == INT_MIN || (m < 0 && static_cast<unsigned>(-m) > prec))
                 return true;
             save_interval_if_too_small(v, prec);
+            if (restore_memo_interval(v, prec))
+                return true;
             if (is_nz_rational(v)) {
                 refine_rational_interval(to_nz_rational(v), prec);
                 return true;
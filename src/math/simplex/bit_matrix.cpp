@@ -30,10 +30,13 @@ bit_matrix::col_iterator bit_matrix::row::end() const {
 void bit_matrix::col_iterator::next() {
     ++m_column;
     while (m_column < r.m.m_num_columns && !r[m_column]) {
-        while ((m_column % 64) == 0 && m_column + 64 < r.m.m_num_columns && !r.r[m_column >> 6]) {
+        // skip entire zero chunks; only advance past a chunk boundary after
+        // checking the whole chunk, so a set bit at a column that is a
+        // multiple of 64 is not stepped over.
+        if ((m_column % 64) == 0 && m_column + 64 <= r.m.m_num_columns && !r.r[m_column >> 6])
             m_column += 64;
-        }
-        ++m_column;
+        else
+            ++m_column;
     }
 }
 
@@ -65,8 +68,13 @@ bit_matrix::row bit_matrix::add_row() {
 }
 
 bit_matrix::row& bit_matrix::row::operator+=(row const& other) {
-    for (unsigned i = 0; i < m.m_num_chunks; ++i) {
-        r[i] ^= other.r[i];
+    // copy the bound and the data pointers into locals so that the stores
+    // do not force reloading them each iteration; the loop then vectorizes.
+    unsigned n = m.m_num_chunks;
+    uint64_t* a = r;
+    uint64_t const* b = other.r;
+    for (unsigned i = 0; i < n; ++i) {
+        a[i] ^= b[i];
     }
     return *this;
 }
@@ -87,14 +95,34 @@ void bit_matrix::solve() {
 
 void bit_matrix::basic_solve() {
     report _report(*this);
+    // Gauss-Jordan with pivot caching: pivots[c] is the row whose leading 1 is
+    // in column c. A row is reduced only against the pivots it conflicts with,
+    // instead of sweeping all rows once per pivot.
+    ptr_vector<uint64_t> pivots(m_num_columns, static_cast<uint64_t*>(nullptr));
     for (row& r : *this) {
-        auto ci = r.begin();
-        if (ci != r.end()) {
+        while (true) {
+            auto ci = r.begin();
+            if (!(ci != r.end()))
+                break; // row was reduced to zero
             unsigned c = *ci;
-            for (row& r2 : *this) {
-                if (r2 != r && r2[c]) r2 += r;
+            uint64_t* p = pivots[c];
+            if (!p) {
+                pivots[c] = r.r;
+                break;
             }
-        }        
+            // clears column c and strictly increases the leading column
+            r += row(*this, p);
+        }
+    }
+    // back-substitution: clear the remaining pivot columns from every row.
+    // Additions only toggle columns above the current one, so the column
+    // iterator stays valid.
+    for (row& r : *this) {
+        for (unsigned c : r) {
+            uint64_t* p = pivots[c];
+            if (p && p != r.r)
+                r += row(*this, p);
+        }
     }
 }
 
@@ -393,7 +393,8 @@ namespace opt {
         rational lub_val;
         rational const& x_val = m_var2value[x];
         unsigned_vector const& row_ids = m_var2row_ids[x];
-        uint_set visited;
+        uint_set& visited = m_visited_rows;
+        visited.reset();
         m_above.reset();
         m_below.reset();
         for (unsigned row_id : row_ids) {
@@ -1081,7 +1082,10 @@ namespace opt {
         rational lub_val, glb_val;
         rational const& x_val = m_var2value[x];
         unsigned_vector const& row_ids = m_var2row_ids[x];
-        uint_set visited;
+        // the scratch set is safe to reuse here: it is consumed by the
+        // selection loop below, before any recursive projection step.
+        uint_set& visited = m_visited_rows;
+        visited.reset();
         lub_rows.reset();
         glb_rows.reset();
         divide_rows.reset();
@@ -21,6 +21,7 @@ Revision History:
 #pragma once
 
 #include "util/util.h"
+#include "util/uint_set.h"
 #include "util/rational.h"
 #include "util/inf_eps_rational.h"
 #include <variant>
@@ -175,6 +176,7 @@ namespace opt {
         vector<var>             m_new_vars;
         unsigned_vector         m_lub, m_glb, m_divides, m_mod, m_div;
         unsigned_vector         m_above, m_below;
+        uint_set                m_visited_rows; // scratch set for deduplicating row ids
         unsigned_vector         m_retired_rows;
         vector<model_based_opt::def_ref> m_result;
 
@@ -551,9 +551,32 @@ namespace simplex {
         int n = 0;
         unsigned best_col_sz = UINT_MAX;
         int best_so_far    = INT_MAX;
-        
+
         row_iterator it = M.row_begin(r), end = M.row_end(r);
-    
+
+        // Fast path for difference-constraint style rows. Besides the base
+        // variable they hold at most two candidates, so the full scoring
+        // scan over each candidate's column is overkill: a single candidate
+        // is forced, and between two candidates the column size is a good
+        // enough proxy for pivot cost. Tableaux dominated by such rows skip
+        // most of the pivot-selection work.
+        if (M.row_size(r) <= 3) {
+            for (; it != end; ++it) {
+                var_t x_j = it->m_var;
+                if (x_i == x_j) continue;
+                numeral const& a_ij = it->m_coeff;
+                bool is_neg = is_below ? m.is_neg(a_ij) : m.is_pos(a_ij);
+                bool is_pos = !is_neg;
+                bool can_pivot = ((is_pos && above_lower(x_j)) || (is_neg && below_upper(x_j)));
+                if (can_pivot && M.column_size(x_j) < best_col_sz) {
+                    result      = x_j;
+                    out_a_ij    = a_ij;
+                    best_col_sz = M.column_size(x_j);
+                }
+            }
+            return result < max ? result : null_var;
+        }
+
         for (; it != end; ++it) {
             var_t x_j       = it->m_var;          
             if (x_i == x_j) continue;
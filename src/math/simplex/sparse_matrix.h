@@ -217,6 +217,7 @@ namespace simplex {
         row_entries_t get_row(row r) { return row_entries_t(*this, r); }
 
         unsigned column_size(var_t v) const { return m_columns[v].size(); }
+        unsigned row_size(row const& r) const { return m_rows[r.id()].size(); }
 
         unsigned num_vars() const { return m_columns.size(); }
         unsigned num_rows() const { return m_rows.size(); }
@@ -59,6 +59,36 @@ public:
     }
 };
 
+/**
+   \brief Node selector that interleaves depth-first and breadth-first search.
+
+   The selector returns the front (deepest) leaf m_dive_ratio times in a row and
+   then the back (shallowest) leaf once. Diving yields small boxes that are pruned
+   quickly, while the periodic jump to a shallow leaf keeps the exploration from
+   getting stuck in one region of the search space.
+*/
+template<typename C>
+class interleaved_node_selector : public context_t<C>::node_selector {
+    typedef typename context_t<C>::node            node;
+    unsigned m_dive_ratio;
+    unsigned m_counter = 0;
+public:
+    interleaved_node_selector(context_t<C> * ctx, unsigned dive_ratio):
+        context_t<C>::node_selector(ctx),
+        m_dive_ratio(dive_ratio) {
+        SASSERT(m_dive_ratio > 0);
+    }
+
+    node * operator()(node * front, node * back) override {
+        if (m_counter < m_dive_ratio) {
+            m_counter++;
+            return front;
+        }
+        m_counter = 0;
+        return back;
+    }
+};
+
 /**
    Round robing variable selector.
    If only_non_def is true, then variable definitions (aka auxiliary variables) are ignored.
@@ -503,6 +533,12 @@ void context_t<C>::updt_params(params_ref const & p) {
         prec = 1;
     nm().set(m_nth_root_prec, static_cast<int>(prec));
     nm().inv(m_nth_root_prec);
+
+    unsigned dive_ratio = p.get_uint("dive_ratio", 0);
+    if (dive_ratio != 0)
+        m_node_selector = alloc(interleaved_node_selector<C>, this, dive_ratio);
+    else
+        m_node_selector = alloc(breadth_first_node_selector<C>, this);
 }
 
 template<typename C>
@@ -512,6 +548,7 @@ void context_t<C>::collect_param_descrs(param_descrs & d) {
     d.insert("epsilon", CPK_UINT, "(default: 20) value k s.t. a new lower (upper) bound for x is propagated only new-lower(x) > lower(k) + 1/k * max(min(upper(x) - lower(x), |lower|), 1) (new-upper(x) < upper(x) - 1/k * max(min(upper(x) - lower(x), |lower|), 1)). If k = 0, then this restriction is ignored.");
     d.insert("max_bound", CPK_UINT, "(default 10) value k s.t. a new upper (lower) bound for x is propagated only if upper(x) > -10^k or lower(x) = -oo (lower(x) < 10^k or upper(x) = oo)");
     d.insert("nth_root_precision", CPK_UINT, "(default 8192) value k s.t. 1/k is the precision for computing the nth root in the subpaving module.");
+    d.insert("dive_ratio", CPK_UINT, "(default: 0) if k > 0, select the deepest leaf k times in a row and then the shallowest leaf once, instead of pure breadth-first search.");
 }
 
 template<typename C>
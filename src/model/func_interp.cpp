@@ -91,10 +91,15 @@ func_interp::~func_interp() {
 func_interp * func_interp::copy() const {
     func_interp * new_fi = alloc(func_interp, m(), m_arity);
 
-    for (func_entry * curr : m_entries) {
-        new_fi->insert_new_entry(curr->get_args(), curr->get_result());
-    }
-    new_fi->set_else(m_else);
+    // The entries of a well-formed interpretation are pairwise distinct and
+    // the stored else branch was already normalized by set_else, so the copy
+    // is assembled directly instead of re-running the insertion checks and
+    // else-normalization entry by entry.
+    for (func_entry * curr : m_entries)
+        new_fi->m_entries.push_back(func_entry::mk(m(), m_arity, curr->get_args(), curr->get_result()));
+    new_fi->m_args_are_values = m_args_are_values;
+    new_fi->m_else = m_else;
+    m().inc_ref(m_else);
     return new_fi;
 }
 
@@ -45,7 +45,7 @@ namespace mev {
 
 struct evaluator_cfg : public default_rewriter_cfg {
     ast_manager &                   m;
-    model_core &                    m_model;
+    model_core *                    m_model;
     params_ref                      m_params;
     bool_rewriter                   m_b_rw;
     arith_rewriter                  m_a_rw;
@@ -70,7 +70,7 @@ struct evaluator_cfg : public default_rewriter_cfg {
 
     evaluator_cfg(ast_manager & m, model_core & md, params_ref const & p):
         m(m),
-        m_model(md),
+        m_model(&md),
         m_params(p),
         m_b_rw(m),
         // We must allow customers to set parameters for arithmetic rewriter/evaluator.
@@ -110,7 +110,7 @@ struct evaluator_cfg : public default_rewriter_cfg {
     }
 
     bool evaluate(func_decl * f, unsigned num, expr * const * args, expr_ref & result) {
-        func_interp * fi = m_model.get_func_interp(f);
+        func_interp * fi = m_model->get_func_interp(f);
         bool r = (fi != nullptr) && eval_fi(fi, num, args, result);
         CTRACE(model_evaluator, r, tout << "reduce_app " << f->get_name() << "\n";
                for (unsigned i = 0; i < num; i++) tout << mk_ismt2_pp(args[i], m) << "\n";
@@ -213,12 +213,12 @@ struct evaluator_cfg : public default_rewriter_cfg {
 
         func_decl* g = nullptr;
         if (num == 0 && m_ar.is_as_array(f, g)) {
-            auto* fi = m_model.get_func_interp(g);
+            auto* fi = m_model->get_func_interp(g);
             if (fi && (result = fi->get_array_interp(g))) 
                 return BR_REWRITE1;
         }
         if (num == 0 && (fid == null_family_id || _is_uninterp)) {
-            expr* val = m_model.get_const_interp(f);
+            expr* val = m_model->get_const_interp(f);
             if (val != nullptr) {
                 result = val;
                 st = contains_redex(val) ? BR_REWRITE_FULL : BR_DONE;
@@ -230,8 +230,8 @@ struct evaluator_cfg : public default_rewriter_cfg {
             
             if (!m_ar.is_as_array(f)) {
                 sort * s   = f->get_range();
-                expr * val = m_model.get_some_value(s);
-                m_model.register_decl(f, val);
+                expr * val = m_model->get_some_value(s);
+                m_model->register_decl(f, val);
                 result = val;
                 return BR_DONE;
             }
@@ -328,12 +328,12 @@ struct evaluator_cfg : public default_rewriter_cfg {
             return true;
         }
         expr_ref tmp(m);
-        func_interp* fi = m_model.get_func_interp(g);
+        func_interp* fi = m_model->get_func_interp(g);
         if (fi && !fi->get_else()) {
-            fi->set_else(m_model.get_some_value(g->get_range()));
+            fi->set_else(m_model->get_some_value(g->get_range()));
         }
         if (fi && (tmp = fi->get_array_interp(g))) {
-            model_evaluator ev(m_model, m_params);
+            model_evaluator ev(*m_model, m_params);
             ev.set_model_completion(false);
             result = ev(tmp);
             m_pinned.push_back(result);
@@ -344,7 +344,7 @@ struct evaluator_cfg : public default_rewriter_cfg {
         
         TRACE(model_evaluator,
             tout << "could not get array interpretation " << mk_pp(g, m) << " " << fi << "\n";
-            tout << m_model << "\n";);                    
+            tout << *m_model << "\n";);                    
 
         return false;
     }
@@ -372,13 +372,13 @@ struct evaluator_cfg : public default_rewriter_cfg {
     bool reduce_macro() { return true; }
 
     bool get_macro(func_decl * f, expr * & def, quantifier * & , proof * &) {
-        func_interp * fi = m_model.get_func_interp(f);
+        func_interp * fi = m_model->get_func_interp(f);
         def = nullptr;
         if (fi) {
             if (fi->is_partial()) {
                 if (m_model_completion) {
                     sort * s   = f->get_range();
-                    expr * val = m_model.get_some_value(s);
+                    expr * val = m_model->get_some_value(s);
                     fi->set_else(val);
                 }
                 else
@@ -387,11 +387,11 @@ struct evaluator_cfg : public default_rewriter_cfg {
             def = fi->get_interp();
             SASSERT(def != nullptr);
         }
-        else if (f->is_polymorphic() && (fi = m_model.get_func_interp(m.poly_root(f)))) {
+        else if (f->is_polymorphic() && (fi = m_model->get_func_interp(m.poly_root(f)))) {
             if (fi->is_partial()) {
                 if (m_model_completion) {
                     sort * s   = f->get_range();
-                    expr * val = m_model.get_some_value(s);
+                    expr * val = m_model->get_some_value(s);
                     fi->set_else(val);
                 }
                 else
@@ -409,10 +409,10 @@ struct evaluator_cfg : public default_rewriter_cfg {
             (f->get_family_id() == null_family_id ||
              m.get_plugin(f->get_family_id())->is_considered_uninterpreted(f))) {
             sort * s   = f->get_range();
-            expr * val = m_model.get_some_value(s);
+            expr * val = m_model->get_some_value(s);
             func_interp * new_fi = alloc(func_interp, m, f->get_arity());
             new_fi->set_else(val);
-            m_model.register_decl(f, new_fi);
+            m_model->register_decl(f, new_fi);
             def = val;
             SASSERT(def != nullptr);
         }
@@ -436,12 +436,12 @@ struct evaluator_cfg : public default_rewriter_cfg {
             return BR_FAILED;
         }
 
-        func_interp * fi = m_model.get_func_interp(f);
+        func_interp * fi = m_model->get_func_interp(f);
 
         func_decl_ref f_ui(m);
         if (!fi && m_au.is_considered_uninterpreted(f, num, args, f_ui)) {
             if (f_ui) {
-                fi = m_model.get_func_interp(f_ui); 
+                fi = m_model->get_func_interp(f_ui); 
             }
 
             if (!fi) {
@@ -450,7 +450,7 @@ struct evaluator_cfg : public default_rewriter_cfg {
             }
         }
         else if (!fi && m_au.is_considered_partially_interpreted(f, num, args, f_ui)) {
-            fi = m_model.get_func_interp(f_ui);
+            fi = m_model->get_func_interp(f_ui);
                             
             if (fi) {
                 auto interp = fi->get_interp();
@@ -470,9 +470,9 @@ struct evaluator_cfg : public default_rewriter_cfg {
             expr* arg = args[0];
             if (m.is_value(arg) && !fi) {
                 fi = alloc(func_interp, m, f->get_arity());
-                expr* val = m_model.get_some_value(f->get_range());
+                expr* val = m_model->get_some_value(f->get_range());
                 fi->set_else(val);
-                m_model.register_decl(f, fi);
+                m_model->register_decl(f, fi);
                 result = val;
                 return BR_DONE;
             }
@@ -687,12 +687,12 @@ struct evaluator_cfg : public default_rewriter_cfg {
         }
         if (!m_ar.is_as_array(a)) {
             TRACE(model_evaluator, tout << "no translation: " << mk_pp(a, m) << "\n";);
-            TRACE(model_evaluator, tout << m_model << "\n";);
+            TRACE(model_evaluator, tout << *m_model << "\n";);
             return false;
         }
 
         func_decl* f = m_ar.get_as_array_func_decl(to_app(a));
-        func_interp* g = m_model.get_func_interp(f);
+        func_interp* g = m_model->get_func_interp(f);
         if (!g) {
             TRACE(model_evaluator, tout << "no interpretation for " << mk_pp(f, m) << "\n";);
             return false;
@@ -743,6 +743,12 @@ struct model_evaluator::imp : public rewriter_tpl<mev::evaluator_cfg> {
         m_cfg.reset();
         m_cfg.m_def_cache.reset();
     }
+    void set_model(model_core & md) {
+        // evaluation and macro caches depend on the interpretations;
+        // the configured theory rewriters carry over unchanged.
+        reset();
+        m_cfg.m_model = &md;
+    }
 };
 
 model_evaluator::model_evaluator(model_core & md, params_ref const & p) {
@@ -785,7 +791,7 @@ unsigned model_evaluator::get_num_steps() const {
 }
 
 void model_evaluator::cleanup(params_ref const & p) {
-    model_core & md = m_imp->cfg().m_model;
+    model_core & md = *m_imp->cfg().m_model;
     m_imp->~imp();
     new (m_imp) imp(md, p);
 }
@@ -800,6 +806,10 @@ void model_evaluator::reset(model_core &model, params_ref const& p) {
     new (m_imp) imp(model, p);
 }
 
+void model_evaluator::set_model(model_core & model) {
+    m_imp->set_model(model);
+}
+
 
 void model_evaluator::operator()(expr * t, expr_ref & result) {
     TRACE(model_evaluator, tout << mk_ismt2_pp(t, m()) << "\n";);
@@ -865,5 +875,5 @@ bool model_evaluator::eval(expr_ref_vector const& ts, expr_ref& r, bool model_co
 }
 
 model_core const & model_evaluator::get_model() const {
-    return m_imp->cfg().m_model;
+    return *m_imp->cfg().m_model;
 }
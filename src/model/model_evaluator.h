@@ -66,6 +66,14 @@ public:
     void reset(params_ref const & p = params_ref());
     void reset(model_core& model, params_ref const & p = params_ref());
 
+    /**
+     * \brief Rebind the evaluator to another model over the same manager.
+     * Unlike reset(model, p), this keeps the configured theory rewriters
+     * and only flushes the evaluation caches, so it is the cheap way to
+     * evaluate a fixed set of terms against many candidate models.
+     */
+    void set_model(model_core& model);
+
     unsigned get_num_steps() const;
 };
 
@@ -483,7 +483,15 @@ namespace datalog {
             q_at_level = m.mk_implies(q, p);
             b.assert_expr(q_at_level);
             expr* qr = q.get();
-            return b.m_solver->check_sat(1, &qr);
+            lbool res = b.m_solver->check_sat(1, &qr);
+            if (res == l_false) {
+                // the query is refuted at this level. The guard q only occurs
+                // in q => p, so the negation of p is implied; assert it to
+                // reuse the refutation at later depths.
+                q_at_level = m.mk_not(p);
+                b.assert_expr(q_at_level);
+            }
+            return res;
         }
 
         proof_ref get_proof(model_ref& md, func_decl* pred, app* prop, unsigned level) {
@@ -1177,6 +1185,13 @@ namespace datalog {
                     get_model(i);
                     return res;
                 }
+                // The solver state is kept across depths and only the new
+                // level is compiled per iteration. The level i query was just
+                // refuted under its activation literal; pin the refutation as
+                // a unit fact, so clauses guarded by the level predicate are
+                // discharged instead of being revisited at later depths.
+                expr_ref not_query(m.mk_not(mk_level_predicate(b.m_query_pred, i)), m);
+                b.assert_expr(not_query);
             }
             return l_undef;
         }
@@ -17,8 +17,10 @@ Author:
 
 #include "muz/dataflow/dataflow.h"
 #include "muz/dataflow/reachability.h"
+#include "muz/dataflow/size_estimate.h"
 
 namespace datalog {
 
     const reachability_info reachability_info::null_fact;
+    const size_estimate_info size_estimate_info::null_fact;
 }
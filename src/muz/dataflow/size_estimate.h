@@ -0,0 +1,97 @@
+/*++
+Copyright (c) 2015 Microsoft Corporation
+
+Module Name:
+
+    size_estimate.h
+
+Abstract:
+
+    Abstract domain for coarse relation size estimates.
+
+    The estimate of a rule is the saturating product of the estimates
+    of its positive tail atoms; the estimate of a predicate is the
+    largest estimate of any of its rules. A head variable that is not
+    bound by the positive tail makes the estimate unbounded. The
+    estimates are meant as a cost model for transformations that
+    duplicate rule bodies: they bound the work of re-deriving a single
+    definition, not the size of the union of all definitions.
+
+Author:
+    Nikolaj Bjorner (nbjorner)
+
+--*/
+#pragma once
+
+#include "muz/dataflow/dataflow.h"
+#include "ast/rewriter/var_subst.h"
+
+namespace datalog {
+    class size_estimate_info {
+        uint64_t m_estimate;
+
+        static uint64_t mul_sat(uint64_t a, uint64_t b) {
+            if (b != 0 && a > unbounded / b)
+                return unbounded;
+            return a * b;
+        }
+
+        bool update(uint64_t est) {
+            if (est <= m_estimate)
+                return false;
+            m_estimate = est;
+            return true;
+        }
+
+        static bool head_is_bound(const rule* r) {
+            expr_free_vars head_vars, tail_vars;
+            head_vars(r->get_head());
+            if (head_vars.empty())
+                return true;
+            for (unsigned i = 0; i < r->get_positive_tail_size(); ++i)
+                tail_vars.accumulate(r->get_tail(i));
+            for (unsigned i = 0; i < head_vars.size(); ++i)
+                if (head_vars[i] && !tail_vars.contains(i))
+                    return false;
+            return true;
+        }
+
+    public:
+        typedef ast_manager ctx_t;
+        static const uint64_t unbounded = UINT64_MAX;
+        static const size_estimate_info null_fact;
+        size_estimate_info() : m_estimate(0) {}
+
+        bool init_up(const ctx_t& m, const rule* r) {
+            return update(head_is_bound(r) ? 1 : unbounded);
+        }
+
+        bool propagate_up(const ctx_t& m, const rule* r, const fact_reader<size_estimate_info>& tail_facts) {
+            uint64_t est = head_is_bound(r) ? 1 : unbounded;
+            for (unsigned i = 0; i < r->get_positive_tail_size(); ++i) {
+                uint64_t tail_est = tail_facts.get(i).m_estimate;
+                if (tail_est == 0) {
+                    // no estimate for the tail atom is available yet
+                    return false;
+                }
+                est = mul_sat(est, tail_est);
+            }
+            return update(est);
+        }
+
+        void join(const ctx_t& m, const size_estimate_info& oth) {
+            update(oth.m_estimate);
+        }
+
+        void dump(const ctx_t& m, std::ostream& outp) const {
+            if (m_estimate == unbounded)
+                outp << "unbounded";
+            else
+                outp << m_estimate;
+        }
+
+        uint64_t get_estimate() const { return m_estimate; }
+    };
+
+    typedef dataflow_engine<size_estimate_info> size_estimates;
+}
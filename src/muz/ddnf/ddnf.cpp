@@ -57,6 +57,7 @@ namespace datalog {
     private:
         tbv_manager&          tbvm;
         tbv const&            m_tbv;
+        uint64_t              m_fixed_mask;
         ddnf_node_vector      m_children;
         unsigned              m_refs;
         unsigned              m_id;
@@ -67,9 +68,25 @@ namespace datalog {
         friend class ddnf_mgr;
 
     public:
+        // fold the fixed positions of t onto a single word.
+        // bit (i mod 64) is set if position i is fixed to 0 or 1.
+        // if a contains b, then every fixed position of a is fixed in b,
+        // so fixed_mask(a) & ~fixed_mask(b) != 0 refutes containment
+        // without visiting the patterns.
+        static uint64_t fixed_bits_mask(tbv_manager& tbvm, tbv const& t) {
+            uint64_t mask = 0;
+            unsigned sz = tbvm.num_tbits();
+            for (unsigned i = 0; i < sz; ++i) {
+                if (t[i] != BIT_x)
+                    mask |= 1ull << (i & 63);
+            }
+            return mask;
+        }
+
         ddnf_node(ddnf_mgr& m, tbv_manager& tbvm, tbv const& tbv, unsigned id):
             tbvm(tbvm),
             m_tbv(tbv),
+            m_fixed_mask(fixed_bits_mask(tbvm, tbv)),
             m_children(m),
             m_refs(0),
             m_id(id),
@@ -100,6 +117,8 @@ namespace datalog {
 
         tbv const& get_tbv() const { return m_tbv; }
 
+        uint64_t fixed_mask() const { return m_fixed_mask; }
+
         void add_child(ddnf_node* n);
         
         void remove_child(ddnf_node* n);
@@ -283,14 +302,15 @@ namespace datalog {
                        m_tbv.display(verbose_stream() << " new node ", new_tbv); verbose_stream() << "\n";);
             SASSERT(m_tbv.contains(root.get_tbv(), new_tbv));
             if (m_eq(&root, new_n)) return;
+            uint64_t new_mask = new_n->fixed_mask();
             ++m_stats.m_num_inserts;
             bool inserted = false;
             for (unsigned i = 0; i < root.num_children(); ++i) {
                 ddnf_node& child = *(root[i]);
                 ++m_stats.m_num_comparisons;
-                IF_VERBOSE(10, m_tbv.display(verbose_stream() << "child ", child.get_tbv()); 
+                IF_VERBOSE(10, m_tbv.display(verbose_stream() << "child ", child.get_tbv());
                            verbose_stream() << " contains: " << m_tbv.contains(child.get_tbv(), new_tbv) << "\n";);
-                if (m_tbv.contains(child.get_tbv(), new_tbv)) {
+                if ((child.fixed_mask() & ~new_mask) == 0 && m_tbv.contains(child.get_tbv(), new_tbv)) {
                     inserted = true;
                     insert(child, new_n, new_intersections);
                 }
@@ -305,7 +325,7 @@ namespace datalog {
                 // cannot be superset
                 SASSERT(!m_tbv.contains(child.get_tbv(),new_tbv));
                 // checking for subset
-                if (m_tbv.contains(new_tbv, child.get_tbv())) {
+                if ((new_mask & ~child.fixed_mask()) == 0 && m_tbv.contains(new_tbv, child.get_tbv())) {
                     subset_children.push_back(&child);
                     IF_VERBOSE(10, m_tbv.display(verbose_stream() << "contains child", child.get_tbv()); verbose_stream() << "\n";);
                     ++m_stats.m_num_comparisons;
@@ -366,7 +366,10 @@ namespace datalog {
         bool perform(execution_context & ctx) override {
             log_verbose(ctx);            
             ++ctx.m_stats.m_join;
-            if (!ctx.reg(m_rel1) || !ctx.reg(m_rel2)) {
+            if (!ctx.reg(m_rel1) || !ctx.reg(m_rel2) ||
+                ctx.reg(m_rel1)->fast_empty() || ctx.reg(m_rel2)->fast_empty()) {
+                // joins against empty deltas are the common case in the
+                // tail iterations of a fixpoint; skip the operation entirely
                 ctx.make_empty(m_res);
                 return true;
             }
@@ -642,7 +645,7 @@ namespace datalog {
         bool perform(execution_context & ctx) override {
             TRACE(dl, tout << "union " << m_src << " into " << m_tgt 
                   << " " << ctx.reg(m_src) << " " << ctx.reg(m_tgt) << "\n";);
-            if (!ctx.reg(m_src)) {
+            if (!ctx.reg(m_src) || ctx.reg(m_src)->fast_empty()) {
                 return true;
             }
             log_verbose(ctx);            
@@ -824,7 +827,8 @@ namespace datalog {
         }
         bool perform(execution_context & ctx) override {
             log_verbose(ctx);            
-            if (!ctx.reg(m_rel1) || !ctx.reg(m_rel2)) {
+            if (!ctx.reg(m_rel1) || !ctx.reg(m_rel2) ||
+                ctx.reg(m_rel1)->fast_empty() || ctx.reg(m_rel2)->fast_empty()) {
                 ctx.make_empty(m_res);
                 return true;
             }
@@ -18,6 +18,7 @@ Revision History:
 --*/
 
 #include<utility>
+#include "util/machine.h"
 #include "muz/base/dl_context.h"
 #include "muz/base/dl_util.h"
 #include "muz/rel/dl_sparse_table.h"
@@ -707,11 +708,17 @@ namespace datalog {
             if (t2_offsets.empty()) {
                 continue;
             }
-            
+
             key_indexer::offset_iterator t2ofs_it  = t2_offsets.begin();
             key_indexer::offset_iterator t2ofs_end = t2_offsets.end();
             for (; t2ofs_it != t2ofs_end; ++t2ofs_it) {
                 store_offset t2ofs = *t2ofs_it;
+                // the matched rows are scattered in t2; fetch a few
+                // iterations ahead so the loads overlap with the
+                // concatenation work.
+                if (t2ofs_end - t2ofs_it > 4) {
+                    machine_prefetch(t2.get_at_offset(t2ofs_it[4]));
+                }
                 result.m_data.ensure_reserve();
                 result.garbage_collect();
                 char * res_reserve = result.m_data.get_reserve_ptr();
@@ -52,33 +52,46 @@ namespace datalog {
 
             hashtable_table * res = static_cast<hashtable_table *>(plugin.mk_empty(get_result_signature()));
 
+            // hash join: index t2 by its join columns, then probe with the
+            // rows of t1, instead of the quadratic nested loop.
+            typedef map<table_fact, unsigned_vector, svector_hash_proc<table_element_hash>,
+                vector_eq_proc<table_fact> > join_index;
+            join_index idx;
+            ptr_vector<const table_fact> rows2;
+            table_fact key;
+
+            hashtable_table::storage::iterator els2it = ht2.m_data.begin();
+            hashtable_table::storage::iterator els2end = ht2.m_data.end();
+            for(; els2it!=els2end; ++els2it) {
+                const table_fact & row2 = *els2it;
+                key.reset();
+                for(unsigned i=0; i<m_joined_col_cnt; i++) {
+                    key.push_back(row2[m_cols2[i]]);
+                }
+                idx.insert_if_not_there(key, unsigned_vector()).push_back(rows2.size());
+                rows2.push_back(&row2);
+            }
+
             hashtable_table::storage::iterator els1it = ht1.m_data.begin();
             hashtable_table::storage::iterator els1end = ht1.m_data.end();
-            hashtable_table::storage::iterator els2end = ht2.m_data.end();
 
             table_fact acc;
 
             for(; els1it!=els1end; ++els1it) {
                 const table_fact & row1 = *els1it;
 
-                hashtable_table::storage::iterator els2it = ht2.m_data.begin();
-                for(; els2it!=els2end; ++els2it) {
-                    const table_fact & row2 = *els2it;
-
-                    bool match=true;
-                    for(unsigned i=0; i<m_joined_col_cnt; i++) {
-                        if(row1[m_cols1[i]]!=row2[m_cols2[i]]) {
-                            match=false;
-                            break;
-                        }
-                    }
-                    if(!match) {
-                        continue;
-                    }
-
+                key.reset();
+                for(unsigned i=0; i<m_joined_col_cnt; i++) {
+                    key.push_back(row1[m_cols1[i]]);
+                }
+                join_index::entry * e = idx.find_core(key);
+                if(!e) {
+                    continue;
+                }
+                for(unsigned ri : e->get_data().m_value) {
                     acc.reset();
                     acc.append(row1);
-                    acc.append(row2);
+                    acc.append(*rows2[ri]);
                     res->m_data.insert(acc);
                 }
             }
@@ -22,6 +22,7 @@ Notes:
 
 #include "math/simplex/sparse_matrix_def.h"
 #include "math/simplex/sparse_matrix_ops.h"
+#include "util/checked_int64.h"
 
 using namespace spacer;
 
@@ -43,11 +44,119 @@ bool spacer_arith_kernel::compute_kernel() {
 }
 
 namespace {
+
+using checked_int = checked_int64<true>;
+
 class simplex_arith_kernel_plugin : public spacer_arith_kernel::plugin {
+    struct stats {
+        unsigned m_num_i64;
+        unsigned m_num_i64_overflow;
+        stats() { reset(); }
+        void reset() {
+            m_num_i64 = 0;
+            m_num_i64_overflow = 0;
+        }
+    };
+    stats m_st;
+
+    /// Fraction-free elimination over dense rows of checked 64-bit integers.
+    ///
+    /// Same algorithm and output convention as
+    /// simplex::sparse_matrix_ops::kernel_ffe, but all arithmetic stays in
+    /// machine words. Returns false if some input entry does not fit in
+    /// int64_t; throws overflow_exception if an intermediate value does not.
+    bool compute_kernel_i64(const spacer_matrix &in, spacer_matrix &out,
+                            vector<unsigned> &basics) {
+        unsigned n_rows = in.num_rows();
+        // extra column for column of 1
+        unsigned n_vars = in.num_cols() + 1;
+
+        vector<svector<checked_int>> M;
+        for (unsigned i = 0; i < n_rows; ++i) {
+            M.push_back(svector<checked_int>());
+            auto &row = M.back();
+            for (unsigned j = 0; j + 1 < n_vars; ++j) {
+                const rational &v = in.get(i, j);
+                if (!v.is_int64()) return false;
+                row.push_back(checked_int(v.get_int64()));
+            }
+            row.push_back(checked_int(1));
+        }
+
+        vector<unsigned> d, c;
+        c.resize(n_rows, 0u);
+        d.resize(n_vars, 0u);
+        checked_int m_ik, m_jk, last_pv(1);
+
+        for (unsigned k = 0; k < n_vars; ++k) {
+            d[k] = 0;
+            for (unsigned j = 0; j < n_rows; ++j) {
+                if (c[j] != 0) continue;
+                if (M[j][k].is_zero()) continue;
+
+                // ensure that pivot is negative
+                if (M[j][k].is_pos()) {
+                    for (auto &e : M[j]) e.neg();
+                }
+                // m_jk is abs(M[j][k])
+                m_jk = abs(M[j][k]);
+
+                for (unsigned i = 0; i < n_rows; ++i) {
+                    if (i == j) continue;
+                    m_ik = M[i][k];
+                    // row_i = (row_i * m_jk + m_ik * row_j) / last_pv
+                    // the division is exact
+                    for (unsigned l = 0; l < n_vars; ++l) {
+                        M[i][l] = (M[i][l] * m_jk + m_ik * M[j][l]) / last_pv;
+                    }
+                }
+                c[j] = k + 1;
+                d[k] = j + 1;
+                last_pv = m_jk;
+                break;
+            }
+        }
+
+        out.reset(n_vars);
+        vector<rational> vec;
+        for (unsigned k = 0; k < n_vars; ++k) {
+            if (d[k] != 0) continue;
+            basics.push_back(k);
+            vec.reset();
+            vec.reserve(n_vars, rational(0));
+            for (unsigned i = 0; i < n_vars; ++i) {
+                if (d[i] > 0)
+                    vec[i] = M[d[i] - 1][k].to_rational();
+                else if (i == k)
+                    vec[i] = last_pv.to_rational();
+            }
+            out.add_row(vec);
+        }
+        return true;
+    }
+
   public:
     bool compute_kernel(const spacer_matrix &in, spacer_matrix &out,
                         vector<unsigned> &basics) override {
         using qmatrix = simplex::sparse_matrix<simplex::mpq_ext>;
+
+        try {
+            if (compute_kernel_i64(in, out, basics)) {
+                ++m_st.m_num_i64;
+                TRACE(gg, {
+                    tout << "Computed kernel (int64)\n";
+                    tout << "basics: " << basics << "\n";
+                    out.display(tout);
+                });
+                return out.num_rows() > 0;
+            }
+        }
+        catch (const overflow_exception &) {
+            // intermediate values do not fit in 64 bits;
+            // redo the computation over rationals
+            ++m_st.m_num_i64_overflow;
+        }
+
         unsynch_mpq_manager m;
         qmatrix qmat(m);
 
@@ -91,8 +200,12 @@ class simplex_arith_kernel_plugin : public spacer_arith_kernel::plugin {
         return out.num_rows() > 0;
     }
 
-    void collect_statistics(statistics &st) const override {}
-    void reset_statistics() override {}
+    void collect_statistics(statistics &st) const override {
+        st.update("SPACER simplex kernel int64", m_st.m_num_i64);
+        st.update("SPACER simplex kernel int64 overflow",
+                  m_st.m_num_i64_overflow);
+    }
+    void reset_statistics() override { m_st.reset(); }
     void reset() override {}
 };
 
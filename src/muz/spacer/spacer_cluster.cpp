@@ -212,7 +212,57 @@ bool lemma_cluster::add_lemma(const lemma_ref &lemma, bool subsume) {
 }
 
 lemma_cluster_finder::lemma_cluster_finder(ast_manager &_m)
-    : m(_m), m_arith(m), m_bv(m) {}
+    : m(_m), m_arith(m), m_bv(m), m_fprint_pinned(m) {}
+
+/// Structural hash of \p e in which all interpreted numeric constants are
+/// identified
+///
+/// Cubes that differ only in interpreted constants (i.e., that are
+/// neighbours) have equal fingerprints. The converse does not hold, so
+/// equal fingerprints are verified by anti-unification. Fingerprints of
+/// subexpressions are cached, so repeated calls are cheap on the shared
+/// structure of lemma cubes.
+unsigned lemma_cluster_finder::fingerprint(expr *e) {
+    unsigned fp = 0;
+    if (m_fprints.find(e, fp)) return fp;
+
+    ptr_vector<expr> todo;
+    todo.push_back(e);
+    while (!todo.empty()) {
+        expr *t = todo.back();
+        if (m_fprints.contains(t)) {
+            todo.pop_back();
+            continue;
+        }
+        if (m_arith.is_numeral(t) || m_bv.is_numeral(t)) {
+            // all numerals map to the same fingerprint
+            fp = 17;
+        }
+        else if (!is_app(t)) {
+            fp = t->hash();
+        }
+        else {
+            app *a = to_app(t);
+            bool ready = true;
+            for (expr *arg : *a) {
+                if (!m_fprints.contains(arg)) {
+                    todo.push_back(arg);
+                    ready = false;
+                }
+            }
+            if (!ready) continue;
+            fp = a->get_decl()->hash();
+            for (expr *arg : *a) {
+                fp = combine_hash(fp, m_fprints[arg]);
+            }
+        }
+        m_fprints.insert(t, fp);
+        m_fprint_pinned.push_back(t);
+        todo.pop_back();
+    }
+    VERIFY(m_fprints.find(e, fp));
+    return fp;
+}
 
 /// Check whether \p cube and \p lcube differ only in interpreted constants
 bool lemma_cluster_finder::are_neighbours(const expr_ref &cube1,
@@ -339,13 +389,15 @@ void lemma_cluster_finder::cluster(lemma_ref &lemma) {
     expr_ref_vector lma_cubes(m);
     lemma_ref_vector neighbours;
 
+    unsigned lcube_fp = fingerprint(lcube);
     for (auto *l : all_lemmas) {
         cube.reset();
         cube = mk_and(l->get_cube());
         normalize_order(cube, cube);
-        // make sure that l is not in any other clusters
-        if (are_neighbours(lcube, cube) && cube != lcube &&
-            !pt.clstr_contains(l)) {
+        // candidate neighbours are found by fingerprint; anti-unification
+        // verifies them lazily. Make sure that l is not in any other cluster
+        if (fingerprint(cube) == lcube_fp && cube != lcube &&
+            !pt.clstr_contains(l) && are_neighbours(lcube, cube)) {
             neighbours.push_back(l);
             lma_cubes.push_back(cube);
         }
@@ -21,6 +21,7 @@ Author:
 #include <ast/ast_util.h>
 #include <ast/substitution/substitution.h>
 #include <muz/spacer/spacer_sem_matcher.h>
+#include <util/obj_hashtable.h>
 #include <util/ref_vector.h>
 #include <util/statistics.h>
 #include <util/stopwatch.h>
@@ -152,6 +153,15 @@ class lemma_cluster_finder {
     arith_util m_arith;
     bv_util m_bv;
 
+    // cache of structural fingerprints of cubes. The fingerprint identifies
+    // all interpreted numeric constants, so cubes that are neighbours have
+    // equal fingerprints and candidates are filtered without anti-unification
+    obj_map<expr, unsigned> m_fprints;
+    expr_ref_vector m_fprint_pinned;
+
+    /// Structural hash of \p e that abstracts interpreted numeric constants
+    unsigned fingerprint(expr *e);
+
     /// Check whether \p cube and \p lcube differ only in interpreted constants
     bool are_neighbours(const expr_ref &cube, const expr_ref &lcube);
 
@@ -2398,6 +2398,23 @@ void context::reset()
     m_inductive_lvl = 0;
 }
 
+void context::reset(func_decl_set const &invalidated)
+{
+    TRACE(spacer, tout << "partial reset of " << invalidated.size()
+                       << " predicates\n";);
+    // the queue holds plain pointers to pobs owned by the transformers
+    // about to be deallocated; flush it while they are still alive
+    m_pob_queue.reset();
+    if (m_query && invalidated.contains(m_query->head())) m_query = nullptr;
+    for (func_decl *p : invalidated) {
+        pred_transformer *pt = nullptr;
+        if (m_rels.find(p, pt)) {
+            dealloc(pt);
+            m_rels.remove(p);
+        }
+    }
+}
+
 void context::init_rules(datalog::rule_set& rules, decl2rel& rels)
 {
     scoped_watch _t_(m_init_rules_watch);
@@ -1004,6 +1004,16 @@ class derivation {
     pred_transformer &pt() const { return m_parent.pt(); }
 };
 
+// Priority queue of open proof obligations.
+//
+// Pobs are discharged strictly sequentially. Discharging mutates state
+// shared across the whole search -- frames, reach facts, the per-predicate
+// solvers, and the ast_manager that hash-conses every expression involved --
+// so obligations at the same level are not independent units of work.
+// Parallelism at the granularity of individual pobs would require a manager
+// (and solver stack) per worker plus expression translation at every lemma
+// exchange; at that point it degenerates into running separate solver
+// instances, which is already available at the portfolio level.
 class pob_queue {
 
     typedef std::priority_queue<pob *, std::vector<pob *>, pob_gt_proc>
@@ -1317,6 +1327,10 @@ class context {
     void collect_statistics(statistics &st) const;
     void reset_statistics();
     void reset();
+    /// Forget the transformers, and hence the lemmas, of the given
+    /// predicates only. Lemmas of the remaining predicates survive into
+    /// the next query through inherit_lemmas.
+    void reset(func_decl_set const &invalidated);
 
     std::ostream &display(std::ostream &out) const;
     void display_certificate(std::ostream &out) const;
@@ -57,24 +57,50 @@ dl_interface::~dl_interface()
 
 
 //
-// Check if the new rules are weaker so that we can
-// re-use existing context.
+// Check which predicates acquired rules that are not subsumed by the
+// previous query, and forget the lemmas that may depend on them, so
+// that the remaining lemmas can be re-used by the next query.
 //
 void dl_interface::check_reset()
 {
     datalog::rule_set const& new_rules = m_ctx.get_rules();
     datalog::rule_ref_vector const& old_rules = m_old_rules.get_rules();
-    bool is_subsumed = !old_rules.empty();
-    for (unsigned i = 0; is_subsumed && i < new_rules.get_num_rules(); ++i) {
-        is_subsumed = false;
-        for (unsigned j = 0; !is_subsumed && j < old_rules.size(); ++j) {
-            if (m_ctx.check_subsumes(*old_rules[j], *new_rules.get_rule(i))) {
-                is_subsumed = true;
+    if (!old_rules.empty()) {
+        func_decl_set invalidated;
+        for (unsigned i = 0; i < new_rules.get_num_rules(); ++i) {
+            datalog::rule *r = new_rules.get_rule(i);
+            bool is_subsumed = false;
+            for (unsigned j = 0; !is_subsumed && j < old_rules.size(); ++j) {
+                if (m_ctx.check_subsumes(*old_rules[j], *r)) {
+                    is_subsumed = true;
+                }
+            }
+            if (!is_subsumed) {
+                TRACE(spacer, r->display(m_ctx, tout << "Fresh rule "););
+                invalidated.insert(r->get_decl());
             }
         }
-        if (!is_subsumed) {
-            TRACE(spacer, new_rules.get_rule(i)->display(m_ctx, tout << "Fresh rule "););
-            m_context->reset();
+        if (!invalidated.empty()) {
+            // A fresh rule for q invalidates the lemmas of q and of every
+            // predicate whose derivations can use q. Lemmas of the
+            // remaining predicates over-approximate derivations built
+            // from unchanged rules only (dropped rules merely shrink the
+            // reachable states), so they remain valid for the new query.
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (auto *r : new_rules) {
+                    if (invalidated.contains(r->get_decl())) continue;
+                    for (unsigned j = 0; j < r->get_uninterpreted_tail_size(); ++j) {
+                        if (invalidated.contains(r->get_tail(j)->get_decl())) {
+                            invalidated.insert(r->get_decl());
+                            changed = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            m_context->reset(invalidated);
         }
     }
     m_old_rules.replace_rules(new_rules);
@@ -41,6 +41,52 @@ namespace spacer {
             m_num_proxies -= m_defs.back ().m_defs.size ();
             m_defs.pop_back ();
         }
+
+        // -- IUC cache entries computed in the popped scopes may depend on
+        // assertions that were just retracted
+        ptr_vector<expr> stale;
+        for (auto &kv : m_iuc_cache) {
+            if (kv.m_value->m_scope > new_lvl) { stale.push_back (kv.m_key); }
+        }
+        for (expr *k : stale) {
+            iuc_cache_entry *e = nullptr;
+            VERIFY (m_iuc_cache.find (k, e));
+            m_iuc_cache.remove (k);
+            dealloc (e);
+        }
+    }
+
+    void iuc_solver::reset_iuc_cache () {
+        for (auto &kv : m_iuc_cache) { dealloc (kv.m_value); }
+        m_iuc_cache.reset ();
+    }
+
+    // Key identifying the current refutation in the IUC cache: the
+    // assumption literals of the query together with the background
+    // literals that appear in the unsat core. Proxies are undone so that
+    // the key is stable across check-sat calls. Background facts that did
+    // not participate in the refutation are left out, so a query that is
+    // refuted independently of them (e.g., under a different frame level)
+    // maps to the same key.
+    expr* iuc_solver::mk_iuc_key () {
+        ptr_vector<expr> lits, bg;
+        app_ref def(m);
+
+        expr_ref_vector unsat_core(m);
+        m_solver.get_unsat_core (unsat_core);
+        expr_fast_mark1 in_core;
+        for (expr *c : unsat_core) { in_core.mark (c); }
+
+        for (unsigned i = 0, sz = m_assumptions.size (); i < sz; ++i) {
+            expr *a = m_assumptions.get (i);
+            if (i < m_first_assumption && !in_core.is_marked (a)) { continue; }
+            expr *l = is_proxy (a, def) ? def->get_arg (1) : a;
+            if (i < m_first_assumption) { bg.push_back (l); }
+            else { lits.push_back (l); }
+        }
+        std::sort (lits.begin (), lits.end (), ast_lt_proc ());
+        std::sort (bg.begin (), bg.end (), ast_lt_proc ());
+        return m.mk_and (mk_and (m, lits), mk_and (m, bg));
     }
 
     app* iuc_solver::fresh_proxy () {
@@ -193,9 +239,13 @@ namespace spacer {
         st.update ("time.iuc_solver.get_iuc.learn_core", m_learn_core_sw.get_seconds());
         
         st.update("iuc_solver.num_proxies", m_proxies.size());
+        st.update("iuc_solver.cache_hits", m_iuc_cache_hits);
+        st.update("iuc_solver.cache_misses", m_iuc_cache_misses);
     }
-    
+
     void iuc_solver::reset_statistics () {
+        m_iuc_cache_hits = 0;
+        m_iuc_cache_misses = 0;
         m_iuc_sw.reset();
         m_hyp_reduce1_sw.reset();
         m_hyp_reduce2_sw.reset();
@@ -252,7 +302,21 @@ namespace spacer {
     
     void iuc_solver::get_iuc(expr_ref_vector &core) {
         scoped_watch _t_ (m_iuc_sw);
-        
+
+        expr_ref key(mk_iuc_key (), m);
+        iuc_cache_entry *entry = nullptr;
+        if (m_iuc_cache.find (key, entry)) {
+            // the same literals were already refuted using the same
+            // background facts. The cached core is still derivable because
+            // assertions are only added while its scope is alive
+            ++m_iuc_cache_hits;
+            core.append (entry->m_core);
+            IF_VERBOSE(2,
+                       verbose_stream () << "IUC Core (cached):\n" << core << "\n";);
+            return;
+        }
+        ++m_iuc_cache_misses;
+
         typedef obj_hashtable<expr> expr_set;
         expr_set core_lits;
         for (unsigned i = m_first_assumption, sz = m_assumptions.size(); i < sz; ++i) {
@@ -427,7 +491,14 @@ namespace spacer {
             // AG: this should be taken care of by minimizing the iuc cut
             simplify_bounds (core);
         }
-        
+
+        // -- cache the core; pobs are frequently re-tried with identical
+        // assumptions at the same or a later frame level
+        if (m_iuc_cache.size () >= 1024) { reset_iuc_cache (); }
+        entry = alloc (iuc_cache_entry, key, m, m_defs.size ());
+        entry->m_core.append (core);
+        m_iuc_cache.insert (key, entry);
+
         IF_VERBOSE(2,
                    verbose_stream () << "IUC Core:\n" << core << "\n";);
     }
@@ -56,6 +56,23 @@ private:
     stopwatch m_hyp_reduce2_sw;
     stopwatch m_learn_core_sw;
 
+    // Cache of computed IUCs. An entry is keyed by the assumption literals
+    // of the query together with the background literals used in the
+    // refutation, and remains valid while the assertions it was derived
+    // from are on the assertion stack.
+    struct iuc_cache_entry {
+        expr_ref        m_key;
+        expr_ref_vector m_core;
+        // wrapper scope (m_defs.size()) at creation; the entry is dropped
+        // when this scope is popped
+        unsigned        m_scope;
+        iuc_cache_entry(expr *key, ast_manager &m, unsigned scope) :
+            m_key(key, m), m_core(m), m_scope(scope) {}
+    };
+    obj_map<expr, iuc_cache_entry*> m_iuc_cache;
+    unsigned m_iuc_cache_hits;
+    unsigned m_iuc_cache_misses;
+
     expr_substitution m_elim_proxies_sub;
     bool m_split_literals;
     unsigned m_iuc;
@@ -67,6 +84,8 @@ private:
     app* mk_proxy(expr *v);
     app* fresh_proxy();
     void elim_proxies(expr_ref_vector &v);
+    expr* mk_iuc_key();
+    void reset_iuc_cache();
 public:
     iuc_solver(solver &s, unsigned iuc, unsigned iuc_arith,
                bool print_farkas_stats, bool old_hyp_reducer,
@@ -79,6 +98,8 @@ public:
         m_assumptions(m),
         m_first_assumption(0),
         m_is_proxied(false),
+        m_iuc_cache_hits(0),
+        m_iuc_cache_misses(0),
         m_elim_proxies_sub(m, false, true),
         m_split_literals(split_literals),
         m_iuc(iuc),
@@ -87,6 +108,8 @@ public:
         m_old_hyp_reducer(old_hyp_reducer)
     {}
 
+    ~iuc_solver() override { reset_iuc_cache(); }
+
     /* iuc solver specific */
     virtual void get_iuc(expr_ref_vector &core);
     void set_split_literals(bool v) { m_split_literals = v; }
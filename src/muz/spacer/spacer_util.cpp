@@ -188,9 +188,10 @@ void qe_project_spacer(ast_manager &m, app_ref_vector &vars, expr_ref &fml,
     expr_safe_replace bool_sub(m);
     expr_ref bval(m);
 
+    params_ref p;
+    qel qe(m, p);
+
     while (true) {
-        params_ref p;
-        qel qe(m, p);
         qe(vars, fml);
         rw(fml);
 
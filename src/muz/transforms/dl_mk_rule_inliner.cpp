@@ -57,6 +57,7 @@ For plan_inlining:
 #include "ast/rewriter/rewriter.h"
 #include "ast/rewriter/rewriter_def.h"
 #include "muz/transforms/dl_mk_rule_inliner.h"
+#include "muz/dataflow/size_estimate.h"
 #include "muz/base/fp_params.hpp"
 
 namespace datalog {
@@ -233,6 +234,18 @@ namespace datalog {
                 }
             }
         }
+
+        unsigned cost_limit = m_context.get_params().xform_inline_cost_limit();
+        if (cost_limit > 0) {
+            size_estimates engine(m, orig);
+            engine.run_bottom_up();
+            for (rule * r : orig) {
+                func_decl * head_pred = r->get_decl();
+                if (engine.get_fact(head_pred).get_estimate() > cost_limit) {
+                    m_preds_with_expensive_defs.insert(head_pred);
+                }
+            }
+        }
     }
 
     bool mk_rule_inliner::inlining_allowed(rule_set const& source, func_decl * pred)
@@ -251,6 +264,13 @@ namespace datalog {
         // in the size of the problem
         //
 
+        if (m_tail_pred_ctr.get(pred) > 1 && m_preds_with_expensive_defs.contains(pred)) {
+            // inlining into multiple tails trades the materialized relation
+            // for re-deriving the definition at every occurrence; don't do it
+            // when the definition is estimated to be expensive.
+            return false;
+        }
+
         return
             //m_head_pred_non_empty_tails_ctr.get(pred)<=1
             m_head_pred_ctr.get(pred) <= 1
@@ -110,6 +110,7 @@ namespace datalog {
         func_decl_set   m_forbidden_preds;
         func_decl_set   m_preds_with_facts;
         func_decl_set   m_preds_with_neg_occurrence;
+        func_decl_set   m_preds_with_expensive_defs;
         ast_counter     m_head_pred_ctr;
         ast_counter     m_head_pred_non_empty_tails_ctr;
         ast_counter     m_tail_pred_ctr;
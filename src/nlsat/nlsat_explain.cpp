@@ -20,6 +20,7 @@ Revision History:
 #include "nlsat/nlsat_assignment.h"
 #include "nlsat/nlsat_evaluator.h"
 #include "math/polynomial/algebraic_numbers.h"
+#include "util/map.h"
 #include "util/ref_buffer.h"
 
 namespace nlsat {
@@ -129,6 +130,13 @@ namespace nlsat {
         scoped_literal_vector * m_result = nullptr;
         svector<char>           m_already_added_literal;
 
+        // memo table for polynomial signs at the current sample point.
+        // keyed by ids of polynomials interned in m_cache, so the ids are
+        // stable while the cache is alive. it must be reset whenever the
+        // relevant interpretation may change: at the explain entry points
+        // and around variable reordering.
+        u_map<int>              m_sign_memo;
+
         evaluator &             m_evaluator;
 
         imp(solver & s, assignment const & x2v, polynomial::cache & u, atom_vector const & atoms, atom_vector const & x2eq,
@@ -210,7 +218,12 @@ namespace nlsat {
         */
         ::sign sign(polynomial_ref const & p) {
             SASSERT(max_var(p) == null_var || m_assignment.is_assigned(max_var(p)));
-            auto s = m_am.eval_sign_at(p, m_assignment);
+            poly * q = m_cache.mk_unique(p);
+            int memo;
+            if (m_sign_memo.find(m_pm.id(q), memo))
+                return static_cast<::sign>(memo);
+            auto s = m_am.eval_sign_at(polynomial_ref(q, m_pm), m_assignment);
+            m_sign_memo.insert(m_pm.id(q), static_cast<int>(s));
             TRACE(nlsat_explain, tout << "p: " << p << " var: " << max_var(p) << " sign: " << s << "\n";);
             return s;
         }
@@ -819,6 +832,7 @@ namespace nlsat {
         }
 
         void test_root_literal(atom::kind k, var y, unsigned i, poly * p, scoped_literal_vector& result) {
+            m_sign_memo.reset();
             m_result = &result;
             add_root_literal(k, y, i, p);
             reset_already_added();
@@ -1748,6 +1762,7 @@ namespace nlsat {
                   display(tout, num, ls) << "\n";
                   m_solver.display_assignment(tout);
                   );
+            m_sign_memo.reset();
             m_result = &result;
             process(num, ls);
             reset_already_added();
@@ -1758,7 +1773,8 @@ namespace nlsat {
 
 
         void project(var x, unsigned num, literal const * ls, scoped_literal_vector & result) {
-            
+
+            m_sign_memo.reset();
             m_result = &result;
             svector<literal> lits;
             TRACE(nlsat, tout << "project x" << x << "\n"; 
@@ -1783,6 +1799,7 @@ namespace nlsat {
                     }
                     std::swap(renaming[x], renaming[mx_var]);
                     m_solver.reorder(renaming.size(), renaming.data());
+                    m_sign_memo.reset();
                     TRACE(qe, tout << "x: " << x << " max: " << mx_var << " num_vars: " << m_solver.num_vars() << "\n";
                           m_solver.display(tout););
                 }
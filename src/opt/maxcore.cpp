@@ -123,6 +123,7 @@ private:
     unsigned         m_correction_set_size = 0;
     bool             m_found_feasible_optimum = false;
     bool             m_hill_climb = true;              // prefer large weight soft clauses for cores
+    unsigned         m_last_index = 0;                 // last hill climb prefix, used to warm-start the next climb
     bool             m_add_upper_bound_block = false;  // restrict upper bound with constraint
     unsigned         m_max_core_size = 3;              // max core size per round.
     bool             m_maximize_assignment = false;    // maximize assignment to find MCS
@@ -321,8 +322,12 @@ public:
                Give preference to cores that have large minimal values.
             */
             sort_assumptions(asms);
-            unsigned last_index = 0;
-            unsigned index = 0;
+            // warm start: the sort is deterministic on weights, so the prefix
+            // reached by the previous climb was already checked modulo the
+            // cores removed since; resume just below it instead of re-checking
+            // all smaller prefixes.
+            unsigned index = asms.empty() ? 0 : std::min(m_last_index, asms.size() - 1);
+            unsigned last_index = index;
             SASSERT(index < asms.size() || asms.empty());
             IF_VERBOSE(10, verbose_stream() << "start hill climb " << index << " asms: " << asms.size() << "\n";);
             while (index < asms.size() && is_sat == l_true) {
@@ -330,6 +335,7 @@ public:
                     index = next_index(asms, index);
                 }
                 last_index = index;
+                m_last_index = index;
                 is_sat = check_sat(index, asms.data());
             }
         }
@@ -1072,6 +1078,7 @@ public:
             add_soft(e, w);
         m_max_upper = m_upper;
         m_found_feasible_optimum = false;
+        m_last_index = 0;
         add_upper_bound_block();
         m_csmodel = nullptr;
         m_correction_set_size = 0;
@@ -57,10 +57,26 @@ namespace opt {
         m_num_improves = 0;
         params_ref old_p(s.get_params());
         save_defaults(old_p);
+        unsigned base_conflicts = m_max_conflicts;
+        if (m_adaptive_budget == 0)
+            m_adaptive_budget = m_max_conflicts;
+        m_max_conflicts = m_adaptive_budget;
         set_lns_params();
         update_best_model(mdl);
-        for (unsigned i = 0; i < 2; ++i)
+        for (unsigned i = 0; i < 2; ++i) {
+            unsigned num_improves = m_num_improves;
             improve_bs();
+            // resize the neighborhood budget by improvement rate:
+            // a fruitless round earns a larger budget for the next probe,
+            // a productive round pays part of it back so probes stay cheap.
+            if (m_num_improves == num_improves)
+                m_max_conflicts = std::min(8 * base_conflicts, 2 * m_max_conflicts);
+            else
+                m_max_conflicts = std::max(base_conflicts, (3 * m_max_conflicts) / 4);
+            set_lns_params();
+        }
+        m_adaptive_budget = m_max_conflicts;
+        m_max_conflicts = base_conflicts;
         IF_VERBOSE(1, verbose_stream() << "(opt.lns :relax-cores " << m_cores.size() << ")\n");
         relax_cores();
         s.updt_params(old_p);
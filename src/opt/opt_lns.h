@@ -44,6 +44,7 @@ namespace opt {
         expr_ref_vector  m_hardened;
         expr_ref_vector  m_unprocessed;
         unsigned         m_max_conflicts { 10000 };
+        unsigned         m_adaptive_budget { 0 };    // conflict budget carried across climbs, resized by improvement rate
         unsigned         m_num_improves { 0 };
         bool             m_cores_are_valid { true };
         bool             m_enable_scoped_bounding { false };
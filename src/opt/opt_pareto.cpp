@@ -35,23 +35,33 @@ namespace opt {
             {
                 m_solver->get_model(m_model);
                 solver::scoped_push _s(*m_solver.get());
+                bool pushed = false;
                 while (is_sat == l_true) {
-                    if (!m.inc()) {
+                    if (!m.inc() || !m_model) {
+                        if (pushed)
+                            m_solver->pop(1);
                         return l_undef;
                     }
-                    if (!m_model)
-                        return l_undef;
-                    m_solver->get_labels(m_labels);                    
+                    m_solver->get_labels(m_labels);
                     m_model->set_model_completion(true);
                     IF_VERBOSE(1,
                                model_ref mdl(m_model);
-                               cb.fix_model(mdl); 
+                               cb.fix_model(mdl);
                                model_smt2_pp(verbose_stream() << "new model:\n", m, *mdl, 0););
                     // TBD: we can also use local search to tune solution coordinate-wise.
+                    // each new model dominates the previous one, so the new
+                    // dominates constraint subsumes the old one; swap it in
+                    // place of stacking one constraint set per improvement step.
+                    if (pushed)
+                        m_solver->pop(1);
+                    m_solver->push();
+                    pushed = true;
                     mk_dominates();
                     is_sat = m_solver->check_sat(0, nullptr);
                     if (is_sat == l_true) m_solver->get_model(m_model);
                 }
+                if (pushed)
+                    m_solver->pop(1);
             }
             if (is_sat == l_undef) {
                 return l_undef;
@@ -27,6 +27,11 @@ namespace opt {
         auto& lits = n->m_literals;
         if (k > lits.size())
             return;
+        // defined output literals form a prefix, and a literal is only
+        // defined once the children cover the bounds it depends on; if
+        // position k is already present the whole subtree is up to date.
+        if (k > 0 && lits.get(k - 1))
+            return;
         auto* l = n->m_left;
         auto* r = n->m_right;
         if (l)
@@ -123,6 +123,31 @@ namespace smt2 {
             signed char n = m_normalized[static_cast<unsigned char>(c)];
             if (n == 'a' || n == '0' || n == '-') {
                 m_string.push_back(c);
+                if (!m_interactive && !m_cache_input) {
+                    // consume the run of symbol characters still in the buffer
+                    // directly, bypassing the per-character branches of next();
+                    // symbol characters never include '\n', so no line counting
+                    while (m_bpos < m_bend) {
+                        c = m_buffer[m_bpos];
+                        n = m_normalized[static_cast<unsigned char>(c)];
+                        if (n != 'a' && n != '0' && n != '-')
+                            break;
+                        m_string.push_back(c);
+                        m_bpos++;
+                        m_spos++;
+                    }
+                    if (m_bpos < m_bend) {
+                        // the delimiter becomes the current character
+                        m_curr = c;
+                        m_bpos++;
+                        m_spos++;
+                        m_string.push_back(0);
+                        m_id = m_string.begin();
+                        TRACE(scanner, tout << "new symbol: " << m_id << "\n";);
+                        return SYMBOL_TOKEN;
+                    }
+                    // buffer exhausted mid-symbol: refill through next()
+                }
                 next();
             }
             else {
@@ -150,17 +175,39 @@ namespace smt2 {
 
     scanner::token scanner::read_number() {
         SASSERT('0' <= curr() && curr() <= '9');
-        rational q(1);
-        m_number = rational(curr() - '0');
+        // Digits are accumulated in a machine word and folded into m_number in
+        // blocks of up to 18; one rational multiply-add per digit is far too
+        // slow for numeral-heavy benchmark files.
+        static const uint64_t pow10[19] = {
+            1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+            10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+            100000000000ull, 1000000000000ull, 10000000000000ull,
+            100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+            100000000000000000ull, 1000000000000000000ull };
+        uint64_t chunk = static_cast<uint64_t>(curr() - '0');
+        unsigned chunk_digits = 1;
+        unsigned fraction_digits = 0;
+        m_number = rational();
+        auto flush_chunk = [&]() {
+            if (m_number.is_zero())
+                m_number = rational(chunk, rational::ui64());
+            else
+                m_number = m_number * rational(pow10[chunk_digits], rational::ui64()) + rational(chunk, rational::ui64());
+            chunk = 0;
+            chunk_digits = 0;
+        };
         next();
         bool is_float = false;
 
         while (!m_at_eof) {
             char c = curr();
             if ('0' <= c && c <= '9') {
-                m_number = rational(10)*m_number + rational(c - '0');
+                chunk = 10 * chunk + static_cast<uint64_t>(c - '0');
+                chunk_digits++;
                 if (is_float)
-                    q *= rational(10);
+                    fraction_digits++;
+                if (chunk_digits == 18)
+                    flush_chunk();
                 next();
             }
             else if (c == '.') {
@@ -173,8 +220,16 @@ namespace smt2 {
                 break;
             }
         }
-        if (is_float)
+        if (chunk_digits > 0)
+            flush_chunk();
+        if (is_float && fraction_digits > 0) {
+            rational q(1);
+            for (; fraction_digits >= 18; fraction_digits -= 18)
+                q *= rational(pow10[18], rational::ui64());
+            if (fraction_digits > 0)
+                q *= rational(pow10[fraction_digits], rational::ui64());
             m_number /= q;
+        }
         TRACE(scanner, tout << "new number: " << m_number << "\n";);
         return is_float ? FLOAT_TOKEN : INT_TOKEN;
     }
@@ -222,29 +277,42 @@ namespace smt2 {
         SASSERT(curr() == '#');
         next();
         char c = curr();
+        // as in read_number, digits are collected in a machine word and folded
+        // into m_number block-wise instead of one rational operation per digit
+        uint64_t chunk = 0;
+        unsigned chunk_bits = 0;
+        auto flush_chunk = [&]() {
+            if (m_number.is_zero())
+                m_number = rational(chunk, rational::ui64());
+            else
+                m_number = m_number * rational::power_of_two(chunk_bits) + rational(chunk, rational::ui64());
+            chunk = 0;
+            chunk_bits = 0;
+        };
         if (c == 'x') {
             next();
             c = curr();
             m_number  = rational(0);
             m_bv_size = 0;
             while (true) {
-                if ('0' <= c && c <= '9') {
-                    m_number *= rational(16);
-                    m_number += rational(c - '0');
-                }
-                else if ('a' <= c && c <= 'f') {
-                    m_number *= rational(16);
-                    m_number += rational(10 + (c - 'a'));
-                }
-                else if ('A' <= c && c <= 'F') {
-                    m_number *= rational(16);
-                    m_number += rational(10 + (c - 'A'));
-                }
+                unsigned d;
+                if ('0' <= c && c <= '9')
+                    d = c - '0';
+                else if ('a' <= c && c <= 'f')
+                    d = 10 + (c - 'a');
+                else if ('A' <= c && c <= 'F')
+                    d = 10 + (c - 'A');
                 else {
                     if (m_bv_size == 0)
                         throw scanner_exception("invalid empty bit-vector literal", m_line, m_spos);
+                    if (chunk_bits > 0)
+                        flush_chunk();
                     return BV_TOKEN;
                 }
+                chunk = (chunk << 4) | d;
+                chunk_bits += 4;
+                if (chunk_bits == 60)
+                    flush_chunk();
                 m_bv_size += 4;
                 next();
                 c = curr();
@@ -256,14 +324,18 @@ namespace smt2 {
             m_number  = rational(0);
             m_bv_size = 0;
             while (c == '0' || c == '1') {
-                m_number *= rational(2);
-                m_number += rational(c - '0');
+                chunk = (chunk << 1) | static_cast<uint64_t>(c - '0');
+                chunk_bits++;
+                if (chunk_bits == 64)
+                    flush_chunk();
                 m_bv_size++;
                 next();
                 c = curr();
             }
             if (m_bv_size == 0)
                 throw scanner_exception("invalid empty bit-vector literal", m_line, m_spos);
+            if (chunk_bits > 0)
+                flush_chunk();
             return BV_TOKEN;
         }
         else if (c == '|') {
@@ -44,7 +44,7 @@ namespace smt2 {
         unsigned           m_bv_size;
         // end of data
         signed char        m_normalized[256];
-#define SCANNER_BUFFER_SIZE 1024
+#define SCANNER_BUFFER_SIZE (64 * 1024)
         char               m_buffer[SCANNER_BUFFER_SIZE];
         unsigned           m_bpos;
         unsigned           m_bend;
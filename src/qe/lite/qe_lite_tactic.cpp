@@ -482,11 +482,13 @@ namespace qel {
             m_pos2var.reserve(num_args, -1);
 
             // Find all definitions
+            ptr_vector<var> vs;
+            expr_ref_vector ts(m);
+            expr_ref t(m);
             for (unsigned i = 0; i < num_args; i++) {
                 checkpoint();
-                ptr_vector<var> vs;
-                expr_ref_vector ts(m);
-                expr_ref t(m);
+                vs.reset();
+                ts.reset();
                 if (is_var_def(is_exists, args[i], vs, ts)) { // vs is the variable, ts is the definition
                     for (unsigned j = 0; j < vs.size(); ++j) {
                         var* v = vs[j];
@@ -616,30 +618,70 @@ namespace qel {
             }
         }
 
-        bool is_unconstrained(var* x, expr* t, unsigned i, expr_ref_vector const& conjs) {
+        /**
+           \brief Increment, for each bound variable of \p e, the number of
+           conjuncts the variable occurs in. A variable is counted at most
+           once per conjunct because variables are hash-consed.
+        */
+        void collect_var_occs(expr* e, unsigned_vector& occs, unsigned offset = 0) {
+            if (is_ground(e)) return;
+            ptr_buffer<expr> todo;
+            ast_mark mark;
+            todo.push_back(e);
+            while (!todo.empty()) {
+                expr* t = todo.back();
+                todo.pop_back();
+                if (mark.is_marked(t) || is_ground(t)) continue;
+                mark.mark(t, true);
+                if (is_var(t)) {
+                    unsigned idx = to_var(t)->get_idx();
+                    if (idx >= offset) {
+                        occs.reserve(idx - offset + 1, 0);
+                        ++occs[idx - offset];
+                    }
+                }
+                else if (is_app(t)) {
+                    todo.append(to_app(t)->get_num_args(), to_app(t)->get_args());
+                }
+                else if (is_quantifier(t)) {
+                    quantifier* q = to_quantifier(t);
+                    collect_var_occs(q->get_expr(), occs, offset + q->get_num_decls());
+                }
+            }
+        }
+
+        bool is_unconstrained(var* x, expr* t, unsigned_vector const& occs) {
             sort* s = x->get_sort();
             if (!m.is_fully_interp(s) || !s->get_num_elements().is_infinite()) return false;
-            bool occ = occurs_var(x->get_idx(), t);
-            for (unsigned j = 0; !occ && j < conjs.size(); ++j) {
-                occ = (i != j) && occurs_var(x->get_idx(), conjs[j]);
-            }
-            return !occ;
+            // the variable occurs in no other conjunct and not in the
+            // other side of the disequality
+            return occs.get(x->get_idx(), 0) == 1 && !occurs_var(x->get_idx(), t);
         }
 
         bool remove_unconstrained(expr_ref_vector& conjs) {
             bool reduced = false, change = true;
             expr *r = nullptr, *l = nullptr, *ne = nullptr;
+
+            // dense index: number of conjuncts each bound variable occurs
+            // in. Maintained incrementally when conjuncts are removed, so
+            // each candidate check is constant time instead of a scan over
+            // all conjuncts
+            unsigned_vector occs, removed;
+            for (expr* c : conjs) { collect_var_occs(c, occs); }
+
             while (change) {
                 change = false;
                 for (unsigned i = 0; i < conjs.size(); ++i) {
                     if (m.is_not(conjs[i].get(), ne) && m.is_eq(ne, l, r)) {
                         TRACE(qe_lite, tout << mk_pp(conjs[i].get(), m) << " " << is_variable(l) << " " << is_variable(r) << "\n";);
-                        if (is_variable(l) && ::is_var(l) && is_unconstrained(::to_var(l), r, i, conjs)) {
-                            conjs[i] = m.mk_true();
-                            reduced = true;
-                            change = true;
-                        }
-                        else if (is_variable(r) && ::is_var(r) && is_unconstrained(::to_var(r), l, i, conjs)) {
+                        if ((is_variable(l) && ::is_var(l) && is_unconstrained(::to_var(l), r, occs)) ||
+                            (is_variable(r) && ::is_var(r) && is_unconstrained(::to_var(r), l, occs))) {
+                            removed.reset();
+                            collect_var_occs(conjs[i].get(), removed);
+                            for (unsigned v = 0; v < removed.size(); ++v) {
+                                SASSERT(occs[v] >= removed[v]);
+                                occs[v] -= removed[v];
+                            }
                             conjs[i] = m.mk_true();
                             reduced = true;
                             change = true;
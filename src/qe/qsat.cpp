@@ -68,6 +68,7 @@ namespace qe {
         m_elevel.reset();
         m_asms.reset();
         m_asms_lim.reset();
+        m_in_asms.reset();
         m_preds.reset();
     }
 
@@ -132,8 +133,13 @@ namespace qe {
 
     void pred_abs::pop(unsigned num_scopes) {
         unsigned l = m_asms_lim.size() - num_scopes;
+        for (unsigned i = m_asms_lim[l]; i < m_asms.size(); ++i) {
+            expr* p = m_asms.get(i);
+            m.is_not(p, p);
+            m_in_asms.mark(p, false);
+        }
         m_asms.resize(m_asms_lim[l]);
-        m_asms_lim.shrink(l);            
+        m_asms_lim.shrink(l);
     }
 
     void pred_abs::insert(app* a, max_level const& lvl) {
@@ -169,17 +175,22 @@ namespace qe {
         expr_ref val(m);
         for (unsigned i = 0; i <= level-1; ++i) {
           for (unsigned j = 0; j < m_preds[i].size(); ++j) {
-            app* p = m_preds[i][j].get();            
-            eval(p, val); 
+            app* p = m_preds[i][j].get();
+            // predicates already in m_asms were assumptions of the check that
+            // produced mdl, so re-evaluating them yields the same literal.
+            if (m_in_asms.is_marked(p))
+                continue;
+            eval(p, val);
             if (!m.inc())
                 return;
             if (m.is_false(val)) {
                 m_asms.push_back(m.mk_not(p));
             }
-            else {                
+            else {
                 SASSERT(m.is_true(val));
                 m_asms.push_back(p);
             }
+            m_in_asms.mark(p);
           }
         }
         asms.append(m_asms);
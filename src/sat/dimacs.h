@@ -29,26 +29,43 @@ namespace dimacs {
     struct lex_error : public std::exception {};
 
     class stream_buffer {
+        static const unsigned BUFFER_SIZE = 1 << 16;
         std::istream & m_stream;
         int            m_val;
-        unsigned       m_line;
+        unsigned       m_line = 0;
+        unsigned       m_pos = 0;
+        unsigned       m_end = 0;
+        char           m_buffer[BUFFER_SIZE];
+
+        int next_char() {
+            // refill in large blocks; CNF and DRAT inputs run to millions of
+            // clauses and per-character istream::get dominates parse time.
+            if (m_pos == m_end) {
+                m_stream.read(m_buffer, BUFFER_SIZE);
+                m_end = static_cast<unsigned>(m_stream.gcount());
+                m_pos = 0;
+                if (m_end == 0)
+                    return EOF;
+            }
+            return static_cast<unsigned char>(m_buffer[m_pos++]);
+        }
+
     public:
-        
-    stream_buffer(std::istream & s):
-        m_stream(s),
-            m_line(0) {
-            m_val = m_stream.get();
+
+        stream_buffer(std::istream & s):
+            m_stream(s) {
+            m_val = next_char();
         }
-        
-        int  operator *() const { 
+
+        int  operator *() const {
             return m_val;
         }
-        
-        void operator ++() { 
-            m_val = m_stream.get();
+
+        void operator ++() {
+            m_val = next_char();
             if (m_val == '\n') ++m_line;
         }
-        
+
         unsigned line() const { return m_line; }
     };
 
@@ -20,6 +20,7 @@ Revision History:
 
 #include "util/vector.h"
 #include "util/machine.h"
+#include "util/memory_manager.h"
 
 class sat_allocator {
     static const unsigned CHUNK_SIZE     = (1 << 16) - sizeof(char*);
@@ -32,7 +33,9 @@ class sat_allocator {
         chunk():m_curr(m_data) {}
     };
     char const *              m_id;
+    memory::domain            m_domain = memory::DOMAIN_OTHER;
     size_t                    m_alloc_size;
+    size_t                    m_wasted_size;
     ptr_vector<chunk>         m_chunks;
     void *                    m_chunk_ptr;
     ptr_vector<void>          m_free[NUM_FREE];
@@ -44,17 +47,24 @@ class sat_allocator {
         return (static_cast<unsigned>(size >> PTR_ALIGNMENT) + ((0 != (size & MASK)) ? 1u : 0u));
     }
 public:
-    sat_allocator(char const * id = "unknown"): m_id(id), m_alloc_size(0), m_chunk_ptr(nullptr) {}
+    sat_allocator(char const * id = "unknown"): m_id(id), m_alloc_size(0), m_wasted_size(0), m_chunk_ptr(nullptr) {}
     ~sat_allocator() { reset(); }
+    // attribute this allocator's bytes to a per-subsystem accounting domain.
+    void set_domain(memory::domain d) { m_domain = d; }
     void reset() {
         for (chunk * ch : m_chunks) dealloc(ch);
         m_chunks.reset();
         for (unsigned i = 0; i < NUM_FREE; ++i) m_free[i].reset();
+        if (m_domain != memory::DOMAIN_OTHER)
+            memory::count_free(m_domain, m_alloc_size);
         m_alloc_size = 0;
+        m_wasted_size = 0;
         m_chunk_ptr = nullptr;
     }
     void * allocate(size_t size) {
         m_alloc_size += size;
+        if (m_domain != memory::DOMAIN_OTHER)
+            memory::count_alloc(m_domain, size);
         if (size >= SMALL_OBJ_SIZE) {
             return memory::allocate(size);
         }
@@ -62,6 +72,7 @@ public:
         if (!m_free[slot_id].empty()) {
             void* result = m_free[slot_id].back();
             m_free[slot_id].pop_back();
+            m_wasted_size -= static_cast<size_t>(slot_id) << PTR_ALIGNMENT;
             return result;
         }
         if (m_chunks.empty()) {
@@ -81,14 +92,20 @@ public:
 
     void deallocate(size_t size, void * p) {
         m_alloc_size -= size;
+        if (m_domain != memory::DOMAIN_OTHER)
+            memory::count_free(m_domain, size);
         if (size >= SMALL_OBJ_SIZE) {
             memory::deallocate(p);
         }
         else {
-            m_free[free_slot_id(size)].push_back(p);
+            unsigned slot_id = free_slot_id(size);
+            m_free[slot_id].push_back(p);
+            m_wasted_size += static_cast<size_t>(slot_id) << PTR_ALIGNMENT;
         }
     }
     size_t get_allocation_size() const { return m_alloc_size; }
+    // bytes parked on free lists; chunks are only released wholesale by reset().
+    size_t get_wasted_size() const { return m_wasted_size; }
 
     char const* id() const { return m_id; }
 };
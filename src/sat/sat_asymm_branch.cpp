@@ -212,11 +212,50 @@ namespace sat {
         scoped_detach scoped_d(s, c);  // clause must not be used for propagation
         unsigned sz = c.size();
         SASSERT(sz > 0);
-        unsigned i = 0, new_sz = sz;
-        for (i = sz; i-- > 0; ) {
-            if (flip_literal_at(c, i, new_sz))
-                return cleanup(scoped_d, c, i, new_sz);
+        VERIFY(s.m_trail.size() == s.m_qhead);
+        // Trail savepoints: the literals ~c[0], ..., ~c[i-1] are kept assigned,
+        // one scope per literal, so consecutive flip positions reuse the
+        // propagation of their common prefix instead of redoing it from
+        // scratch. This is sound because c stays detached throughout, so no
+        // assignment on the shared trail was produced by c itself.
+        unsigned prefix = 0; // number of scopes/prefix literals currently assigned
+        unsigned new_sz = sz;
+        unsigned flip_index = sz;
+        bool found_conflict = false;
+        for (unsigned i = sz; i-- > 0 && !found_conflict; ) {
+            if (prefix > i) { // shrink to the prefix shared with this flip position
+                s.pop(prefix - i);
+                prefix = i;
+            }
+            flip_index = i;
+            while (prefix < i) { // extend the shared prefix
+                s.push();
+                found_conflict = propagate_literal(c, ~c[prefix]);
+                ++prefix;
+                if (found_conflict) {
+                    new_sz = prefix;
+                    break;
+                }
+            }
+            if (found_conflict)
+                break;
+            // assign the remaining literals and the flipped one in a throwaway scope
+            s.push();
+            unsigned j;
+            for (j = i + 1; !found_conflict && j < sz; ++j)
+                found_conflict = propagate_literal(c, ~c[j]);
+            if (found_conflict)
+                new_sz = j;
+            else {
+                found_conflict = propagate_literal(c, c[i]);
+                new_sz = sz;
+            }
+            s.pop(1);
         }
+        if (prefix > 0)
+            s.pop(prefix);
+        if (found_conflict)
+            return cleanup(scoped_d, c, flip_index, new_sz);
         return true;
     }
 
@@ -344,8 +383,12 @@ namespace sat {
         }
         SASSERT(!s.inconsistent());
         TRACE(asymm_branch_detail, tout << "assigning: " << l << "\n";);
+        unsigned old_sz = s.m_trail.size();
         s.assign_scoped(l);
         s.propagate_core(false); // must not use propagate(), since check_missed_propagation may fail for c
+        // charge the budget with the actual propagation volume, so expensive
+        // clauses consume it faster than cheap ones.
+        m_counter -= s.m_trail.size() - old_sz;
         return s.inconsistent();
     }
 
@@ -79,9 +79,15 @@ namespace sat {
         m_learned = learned;
         m_num_vars = num_vars;
         unsigned num_lits = m_num_vars * 2;
-        m_dag.reset();
+        // clear the adjacency lists in place instead of resetting the outer
+        // vector: this keeps their capacity, so repeated initializations during
+        // inprocessing do not reallocate 2 * num_vars edge vectors each sweep.
+        if (m_dag.size() > num_lits)
+            m_dag.shrink(num_lits);
+        for (auto& edges : m_dag)
+            edges.reset();
+        m_dag.resize(num_lits);
         m_roots.reset();
-        m_dag.resize(num_lits, 0);
         m_roots.resize(num_lits, true);
     }
 
@@ -180,7 +186,10 @@ namespace sat {
     unsigned big::reduce_tr(solver& s) {
         unsigned idx = 0;
         unsigned elim = 0;
-        m_del_bin.reset();
+        // as with the adjacency lists, clear the deletion lists in place to
+        // keep their capacity across sweeps.
+        for (auto& d : m_del_bin)
+            d.reset();
         m_del_bin.reserve(s.m_watches.size());
         for (watch_list & wlist : s.m_watches) {
             if (s.inconsistent()) 
@@ -116,7 +116,7 @@ namespace sat {
 
     clause_offset clause::get_new_offset() const {
         unsigned o1 = m_lits[0].index();
-#if defined(__LP64__) || defined(_WIN64)
+#if (defined(__LP64__) || defined(_WIN64)) && !defined(Z3_COMPACT_CLAUSE_OFFSET)
         if (sizeof(clause_offset) == 8) {
             unsigned o2 = m_lits[1].index();
             return (clause_offset)o1 + (((clause_offset)o2) << 32);
@@ -127,7 +127,7 @@ namespace sat {
 
     void clause::set_new_offset(clause_offset offset) {
         m_lits[0] = to_literal(static_cast<unsigned>(offset));
-#if defined(__LP64__) || defined(_WIN64)
+#if (defined(__LP64__) || defined(_WIN64)) && !defined(Z3_COMPACT_CLAUSE_OFFSET)
         if (sizeof(offset) == 8) {
             m_lits[1] = to_literal(static_cast<unsigned>(offset >> 32));
         }
@@ -158,12 +158,43 @@ namespace sat {
 
     clause_allocator::clause_allocator():
         m_allocator("clause-allocator") {
+        m_allocator.set_domain(memory::DOMAIN_SAT_CLAUSE);
     }
 
     void clause_allocator::finalize() {
         m_allocator.reset();
     }
 
+#ifdef Z3_COMPACT_CLAUSE_OFFSET
+
+    unsigned clause_allocator::get_segment(clause const * cls) {
+        size_t ptr = reinterpret_cast<size_t>(cls);
+        SASSERT((ptr & c_alignment_mask) == 0);
+        char const * base = reinterpret_cast<char const*>(ptr & ~static_cast<size_t>(UINT_MAX));
+        for (unsigned i = 0; i < m_num_segments; ++i)
+            if (m_segments[i] == base)
+                return i;
+        if (m_num_segments == c_max_segments)
+            throw solver_exception("clause memory spans too many 4GB segments for compact clause offsets");
+        m_segments[m_num_segments] = base;
+        return m_num_segments++;
+    }
+
+    clause * clause_allocator::get_clause(clause_offset cls_off) const {
+        unsigned segment = cls_off & c_alignment_mask;
+        SASSERT(segment < m_num_segments);
+        return reinterpret_cast<clause*>(const_cast<char*>(m_segments[segment]) + (cls_off & ~c_alignment_mask));
+    }
+
+    clause_offset clause_allocator::get_offset(clause const * cls) const {
+        unsigned segment = const_cast<clause_allocator*>(this)->get_segment(cls);
+        clause_offset off = static_cast<clause_offset>(reinterpret_cast<size_t>(cls)) | segment;
+        SASSERT(get_clause(off) == cls);
+        return off;
+    }
+
+#else
+
     clause * clause_allocator::get_clause(clause_offset cls_off) const {
         SASSERT(cls_off == reinterpret_cast<clause_offset>(reinterpret_cast<clause*>(cls_off)));
         return reinterpret_cast<clause *>(cls_off);
@@ -174,6 +205,8 @@ namespace sat {
         return reinterpret_cast<size_t>(cls);
     }
 
+#endif
+
     clause * clause_allocator::mk_clause(unsigned num_lits, literal const * lits, bool learned) {
         size_t size = clause::get_obj_size(num_lits);
         void * mem = m_allocator.allocate(size);
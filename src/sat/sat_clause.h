@@ -138,10 +138,20 @@ namespace sat {
     class clause_allocator {
         sat_allocator    m_allocator;
         id_gen           m_id_gen;
+#ifdef Z3_COMPACT_CLAUSE_OFFSET
+        // Clauses are addressed as (4GB-aligned segment, offset) pairs. The
+        // segment id is stored in the alignment bits of the 32-bit offset.
+        static const unsigned c_alignment_mask = (1 << PTR_ALIGNMENT) - 1;
+        static const unsigned c_max_segments   = 1 << PTR_ALIGNMENT;
+        unsigned         m_num_segments = 0;
+        char const *     m_segments[c_max_segments];
+        unsigned         get_segment(clause const * cls);
+#endif
     public:
         clause_allocator();
         void          finalize();
         size_t        get_allocation_size() const { return m_allocator.get_allocation_size(); }
+        size_t        get_wasted_size() const { return m_allocator.get_wasted_size(); }
         clause *      get_clause(clause_offset cls_off) const;
         clause_offset get_offset(clause const * ptr) const;
         clause *      mk_clause(unsigned num_lits, literal const * lits, bool learned);
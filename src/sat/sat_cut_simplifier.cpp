@@ -285,7 +285,7 @@ namespace sat {
     }
 
     void cut_simplifier::cuts2equiv(vector<cut_set> const& cuts) {
-        map<cut const*, unsigned, cut::hash_proc, cut::eq_proc> cut2id;                
+        map<cut, unsigned, cut::hash_proc, cut::eq_proc> cut2id;
         bool new_eq = false;
         union_find_default_ctx ctx;
         union_find<> uf(ctx);
@@ -309,18 +309,22 @@ namespace sat {
                 else if (m_config.m_enable_units && c.is_false()) {
                     assign_unit(nc, ~u);
                 }
-                else if (cut2id.find(&c, j)) {
-                    literal v(j, false);
-                    assign_equiv(c, u, v);
-                    add_eq(u, v);
-                }
-                else if (cut2id.find(&nc, j)) {
-                    literal v(j, true);
-                    assign_equiv(c, u, v);
-                    add_eq(u, v);
-                }
                 else {
-                    cut2id.insert(&c, i);
+                    // canonicalize the output phase: a cut and its negation
+                    // intern to the same entry, so a single lookup detects
+                    // equivalences of either polarity. The entry records the
+                    // phase its cut was canonicalized with.
+                    bool sign = nc.table() < c.table();
+                    cut const& key = sign ? nc : c;
+                    if (cut2id.find(key, j)) {
+                        literal v = to_literal(j);
+                        if (sign) v.neg();
+                        assign_equiv(c, u, v);
+                        add_eq(u, v);
+                    }
+                    else {
+                        cut2id.insert(key, literal(i, sign).index());
+                    }
                 }
             }
         }        
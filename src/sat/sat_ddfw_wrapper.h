@@ -41,6 +41,8 @@ namespace sat {
 
         void set_plugin(local_search_plugin* p) { m_ddfw.set_plugin(p); }
 
+        void set_shared_best(ddfw_shared_best* s) { m_ddfw.set_shared_best(s); }
+
         lbool check(unsigned sz, literal const* assumptions, parallel* p) override;
 
         void updt_params(params_ref const& p) override { m_ddfw.updt_params(p); }
@@ -31,9 +31,13 @@ namespace sat {
     {
         if (s.get_config().m_drat && s.get_config().m_drat_file.is_non_empty_string()) {
             auto mode = s.get_config().m_drat_binary ? (std::ios_base::binary | std::ios_base::out | std::ios_base::trunc) : std::ios_base::out;
-            m_out = alloc(std::ofstream, s.get_config().m_drat_file.str(), mode);
-            if (s.get_config().m_drat_binary) 
-                std::swap(m_out, m_bout);            
+            m_file = alloc(std::ofstream, s.get_config().m_drat_file.str(), mode);
+            // proof records are buffered and written in large blocks by a
+            // dedicated thread, so proof logging overlaps search.
+            m_sbuf = alloc(async_streambuf, *m_file);
+            m_out = alloc(std::ostream, m_sbuf);
+            if (s.get_config().m_drat_binary)
+                std::swap(m_out, m_bout);
         }
     }
 
@@ -42,6 +46,8 @@ namespace sat {
         if (m_bout) m_bout->flush();
         dealloc(m_out);
         dealloc(m_bout);
+        dealloc(m_sbuf);  // joins the writer thread
+        dealloc(m_file);
         for (auto & [c, st] : m_proof) 
             m_alloc.del_clause(&c);            
         m_proof.reset();
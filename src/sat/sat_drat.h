@@ -21,7 +21,9 @@ Notes:
 --*/
 #pragma once
 
+#include <fstream>
 #include "sat_types.h"
+#include "util/async_streambuf.h"
 
 namespace sat {
     class justification;
@@ -50,6 +52,8 @@ namespace sat {
         typedef svector<unsigned> watch;
         solver& s;
         clause_allocator        m_alloc;
+        std::ofstream*          m_file = nullptr;
+        async_streambuf*        m_sbuf = nullptr;
         std::ostream*           m_out = nullptr;
         std::ostream*           m_bout = nullptr;
         svector<std::pair<clause&, status>> m_proof;
@@ -95,7 +95,7 @@ namespace sat {
         }
     }
 
-    void elim_eqs::cleanup_clauses(literal_vector const & roots, clause_vector & cs) {
+    void elim_eqs::cleanup_clauses(literal_vector const & roots, var_approx_set const & changed, clause_vector & cs) {
         clause_vector::iterator it  = cs.begin();
         clause_vector::iterator it2 = it;
         clause_vector::iterator end = cs.end();
@@ -104,6 +104,14 @@ namespace sat {
             TRACE(sats, tout << "processing: " << c << "\n";);
             unsigned sz    = c.size();
             unsigned i;
+            if (empty(mk_intersection(c.approx(), changed))) {
+                // approximation is a superset of the clause variables, so
+                // no literal of c is remapped; skip the literal scan.
+                DEBUG_CODE(for (literal l : c) SASSERT(l == norm(roots, l)););
+                *it2 = *it;
+                it2++;
+                continue;
+            }
             for (i = 0; i < sz; i++) {
                 literal l = c[i];
                 literal r = norm(roots, l);
@@ -281,9 +289,16 @@ namespace sat {
         TRACE(elim_eqs, tout << "before bin cleanup\n"; m_solver.display(tout););
         cleanup_bin_watches(roots);
         TRACE(elim_eqs, tout << "after bin cleanup\n"; m_solver.display(tout););
-        cleanup_clauses(roots, m_solver.m_clauses);
+        // approximation of the remapped variables; clauses whose variable
+        // approximation does not intersect it are untouched and can be
+        // skipped without inspecting their literals.
+        var_approx_set changed;
+        for (unsigned v = roots.size(); v-- > 0; )
+            if (roots[v] != literal(v, false))
+                changed.insert(v);
+        cleanup_clauses(roots, changed, m_solver.m_clauses);
         if (m_solver.inconsistent()) return;
-        cleanup_clauses(roots, m_solver.m_learned);
+        cleanup_clauses(roots, changed, m_solver.m_learned);
         if (m_solver.inconsistent()) return;
         save_elim(roots, to_elim);
         m_solver.propagate(false);
@@ -36,7 +36,7 @@ namespace sat {
         tmp_clause* m_to_delete;
         void drat_delete_clause();
         void save_elim(literal_vector const & roots, bool_var_vector const & to_elim);
-        void cleanup_clauses(literal_vector const & roots, clause_vector & cs);
+        void cleanup_clauses(literal_vector const & roots, var_approx_set const & changed, clause_vector & cs);
         void cleanup_bin_watches(literal_vector const & roots);
         bool check_clauses(literal_vector const & roots) const;
         bool check_clause(clause const& c, literal_vector const& roots) const;
@@ -29,9 +29,13 @@ namespace sat {
     // -----------------------
 
     bool solver::should_gc() const {
-        return 
-            m_conflicts_since_gc > m_gc_threshold &&
-            (m_config.m_gc_strategy != GC_DYN_PSM || at_base_lvl());
+        if (m_config.m_gc_strategy == GC_DYN_PSM && !at_base_lvl())
+            return false;
+        if (m_conflicts_since_gc > m_gc_threshold)
+            return true;
+        // degrade early when approaching the memory budget instead of
+        // waiting for the full conflict threshold (and possibly a memout).
+        return m_conflicts_since_gc > m_gc_threshold / 4 && memory::above_soft_limit();
     }
 
     void solver::do_gc() {
@@ -121,27 +125,47 @@ namespace sat {
         }
     };
 
+    /**
+       \brief Move the core tier (clauses with small glue, which are never
+       deleted) to a stable prefix of m_learned, so the sorting strategies
+       neither sort nor scan it. Returns the start of the local tier.
+    */
+    unsigned solver::gc_partition_core() {
+        unsigned j = 0;
+        unsigned sz = m_learned.size();
+        for (unsigned i = 0; i < sz; ++i) {
+            clause & c = *(m_learned[i]);
+            if (c.glue() <= m_config.m_gc_small_lbd)
+                std::swap(m_learned[i], m_learned[j++]);
+        }
+        return j;
+    }
+
     void solver::gc_glue() {
-        std::stable_sort(m_learned.begin(), m_learned.end(), glue_lt());
-        gc_half("glue");
+        unsigned core_end = gc_partition_core();
+        std::stable_sort(m_learned.begin() + core_end, m_learned.end(), glue_lt());
+        gc_half("glue", core_end);
     }
 
     void solver::gc_psm() {
         save_psm();
-        std::stable_sort(m_learned.begin(), m_learned.end(), psm_lt());
-        gc_half("psm");
+        unsigned core_end = gc_partition_core();
+        std::stable_sort(m_learned.begin() + core_end, m_learned.end(), psm_lt());
+        gc_half("psm", core_end);
     }
 
     void solver::gc_glue_psm() {
         save_psm();
-        std::stable_sort(m_learned.begin(), m_learned.end(), glue_psm_lt());
-        gc_half("glue-psm");
+        unsigned core_end = gc_partition_core();
+        std::stable_sort(m_learned.begin() + core_end, m_learned.end(), glue_psm_lt());
+        gc_half("glue-psm", core_end);
     }
 
     void solver::gc_psm_glue() {
         save_psm();
-        std::stable_sort(m_learned.begin(), m_learned.end(), psm_glue_lt());
-        gc_half("psm-glue");
+        unsigned core_end = gc_partition_core();
+        std::stable_sort(m_learned.begin() + core_end, m_learned.end(), psm_glue_lt());
+        gc_half("psm-glue", core_end);
     }
 
     /**
@@ -154,16 +178,24 @@ namespace sat {
     }
 
     /**
-       \brief GC (the second) half of the clauses in the database.
+       \brief GC (the second) half of the clauses in [start, size()).
+       Clauses below start form the core tier and are not considered.
     */
-    void solver::gc_half(char const * st_name) {
+    void solver::gc_half(char const * st_name, unsigned start) {
         TRACE(sat, tout << "gc\n";);
         unsigned sz     = m_learned.size();
-        unsigned new_sz = sz/2; // std::min(sz/2, m_clauses.size()*2);
+        unsigned new_sz = start + (sz - start)/2;
         unsigned j      = new_sz;
         for (unsigned i = new_sz; i < sz; i++) {
             clause & c = *(m_learned[i]);
-            if (can_delete(c)) {
+            if (c.was_used()) {
+                // tier2: the clause participated in a recent conflict;
+                // demote it instead of deleting it right away.
+                c.unmark_used();
+                m_learned[j] = &c;
+                j++;
+            }
+            else if (can_delete(c)) {
                 detach_clause(c);
                 del_clause(c);
             }
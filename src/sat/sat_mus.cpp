@@ -107,6 +107,8 @@ namespace sat {
                 SASSERT(value_at(lit, s.get_model()) == l_false);
                 mus.push_back(lit);
                 update_model();
+                unsigned nr = rotate(core, mus, lit, s.get_model());
+                IF_VERBOSE(3, if (nr > 0) verbose_stream() << "(sat.mus :rotated " << nr << ")\n";);
                 break;
             }
             case l_false:
@@ -133,6 +135,93 @@ namespace sat {
     }
     
 
+    // Model rotation (cf. Belov et.al.): the model witnessing that lit is
+    // necessary satisfies the clauses and every assumption except lit. A
+    // witness for another core literal l2 can differ from it in just the
+    // values of var(lit) and var(l2), and flipping two variables only
+    // changes the truth of clauses they occur in. So candidates from the
+    // core are certified by evaluating those clauses, without a solver call.
+    unsigned mus::rotate(literal_vector& core, literal_vector& mus, literal lit, model const& mdl) {
+        if (s.m_ext)
+            return 0; // extension constraints cannot be evaluated here
+        bool_vector interesting(s.num_vars(), false);
+        interesting[lit.var()] = true;
+        for (literal l : core)
+            interesting[l.var()] = true;
+        // flipping a variable must not change the value of any other assumption
+        unsigned_vector assumed(s.num_vars(), 0u);
+        for (literal l : core)
+            assumed[l.var()]++;
+        for (literal l : mus)
+            assumed[l.var()]++;
+        vector<ptr_vector<clause>> occs(s.num_vars());
+        for (clause* cp : s.m_clauses)
+            for (literal l : *cp)
+                if (interesting[l.var()])
+                    occs[l.var()].push_back(cp);
+        svector<std::pair<literal, literal>> bins;
+        vector<unsigned_vector> bin_occs(s.num_vars());
+        unsigned l_idx = 0;
+        for (watch_list const& wlist : s.m_watches) {
+            literal l1 = ~to_literal(l_idx++);
+            for (watched const& w : wlist) {
+                if (!w.is_binary_non_learned_clause())
+                    continue;
+                literal l2 = w.get_literal();
+                if (l1.index() > l2.index())
+                    continue; // visited from the other watch list
+                if (!interesting[l1.var()] && !interesting[l2.var()])
+                    continue;
+                unsigned i = bins.size();
+                bins.push_back(std::make_pair(l1, l2));
+                if (interesting[l1.var()])
+                    bin_occs[l1.var()].push_back(i);
+                if (interesting[l2.var()] && l2.var() != l1.var())
+                    bin_occs[l2.var()].push_back(i);
+            }
+        }
+        model m2(mdl);
+        m2[lit.var()] = ~m2[lit.var()];
+        auto satisfied = [&](bool_var v) {
+            for (clause* cp : occs[v]) {
+                bool sat = false;
+                for (literal l : *cp)
+                    if (value_at(l, m2) == l_true) {
+                        sat = true;
+                        break;
+                    }
+                if (!sat)
+                    return false;
+            }
+            for (unsigned i : bin_occs[v])
+                if (value_at(bins[i].first, m2) != l_true && value_at(bins[i].second, m2) != l_true)
+                    return false;
+            return true;
+        };
+        unsigned certified = 0;
+        unsigned j = 0;
+        for (literal l2 : core) {
+            bool ok =
+                l2.var() != lit.var() &&
+                assumed[l2.var()] == 1 && assumed[lit.var()] == 1 &&
+                s.value(l2.var()) == l_undef && s.value(lit.var()) == l_undef;
+            if (ok) {
+                m2[l2.var()] = ~m2[l2.var()];
+                ok = satisfied(lit.var()) && satisfied(l2.var());
+                m2[l2.var()] = ~m2[l2.var()];
+            }
+            if (ok) {
+                mus.push_back(l2);
+                ++certified;
+            }
+            else {
+                core[j++] = l2;
+            }
+        }
+        core.shrink(j);
+        return certified;
+    }
+
     // bisection search.
     lbool mus::mus2() {
         literal_set core(get_core());
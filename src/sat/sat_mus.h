@@ -36,6 +36,7 @@ namespace sat {
     private:
         lbool mus1();
         lbool mus2();
+        unsigned rotate(literal_vector& core, literal_vector& mus, literal lit, model const& mdl);
         lbool qx(literal_set& assignment, literal_set& support, bool has_support);
         void reset();
         void set_core();
@@ -127,6 +127,7 @@ namespace sat {
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         {
             lock_guard lock(m_mux);
+            flush_staged(s.m_par_id);
             if (limit < m_units.size()) {
                 // this might repeat some literals.
                 out.append(m_units.size() - limit, m_units.data() + limit);
@@ -146,33 +147,53 @@ namespace sat {
         if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  l1 << " " << l2 << "\n";);
-        {
+        unsigned owner = s.m_par_id;
+        unsigned_vector& buf = m_staging[owner];
+        buf.push_back(2);
+        buf.push_back(l1.index());
+        buf.push_back(l2.index());
+        if (buf.size() >= STAGING_LIMIT) {
             lock_guard lock(m_mux);
-            m_pool.begin_add_vector(s.m_par_id, 2);
-            m_pool.add_vector_elem(l1.index());
-            m_pool.add_vector_elem(l2.index());            
-            m_pool.end_add_vector();
-        }        
+            flush_staged(owner);
+        }
     }
 
-    void parallel::share_clause(solver& s, clause const& c) {        
+    void parallel::share_clause(solver& s, clause const& c) {
         if (s.get_config().m_num_threads == 1 || !enable_add(c) || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         unsigned n = c.size();
         unsigned owner = s.m_par_id;
         IF_VERBOSE(3, verbose_stream() << owner << ": share " <<  c << "\n";);
-        lock_guard lock(m_mux);
-        m_pool.begin_add_vector(owner, n);                
-        for (unsigned i = 0; i < n; ++i) 
-            m_pool.add_vector_elem(c[i].index());
-        m_pool.end_add_vector();        
+        unsigned_vector& buf = m_staging[owner];
+        buf.push_back(n);
+        for (unsigned i = 0; i < n; ++i)
+            buf.push_back(c[i].index());
+        if (buf.size() >= STAGING_LIMIT) {
+            lock_guard lock(m_mux);
+            flush_staged(owner);
+        }
+    }
+
+    void parallel::flush_staged(unsigned owner) {
+        // pre-condition: m_mux is held by the caller.
+        unsigned_vector& buf = m_staging[owner];
+        unsigned i = 0;
+        while (i < buf.size()) {
+            unsigned n = buf[i++];
+            m_pool.begin_add_vector(owner, n);
+            for (unsigned j = 0; j < n; ++j)
+                m_pool.add_vector_elem(buf[i++]);
+            m_pool.end_add_vector();
+        }
+        buf.reset();
     }
 
     void parallel::get_clauses(solver& s) {
         if (s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         lock_guard lock(m_mux);
-        _get_clauses(s);        
+        flush_staged(s.m_par_id);
+        _get_clauses(s);
     }
 
     void parallel::_get_clauses(solver& s) {
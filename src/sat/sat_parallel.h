@@ -49,6 +49,7 @@ namespace sat {
         };
 
         bool enable_add(clause const& c) const;
+        void flush_staged(unsigned owner);
         void _get_clauses(solver& s);
         void _from_solver(solver& s);
         void _to_solver(solver& s);
@@ -62,6 +63,12 @@ namespace sat {
         vector_pool    m_pool;
         mutex          m_mux;
 
+        // Per-thread staging of clauses destined for the shared pool.
+        // Each buffer is written only by its owner thread, so clauses are
+        // staged without taking m_mux and published in batches at sync points.
+        static const unsigned STAGING_LIMIT = 256;
+        vector<unsigned_vector> m_staging;
+
         // for exchange with local search:
         unsigned           m_num_clauses;
         scoped_ptr<solver> m_solver_copy;
@@ -85,7 +92,11 @@ namespace sat {
         void push_child(reslimit& rl);
 
         // reserve space
-        void reserve(unsigned num_owners, unsigned sz) { m_pool.reserve(num_owners, sz); }
+        void reserve(unsigned num_owners, unsigned sz) {
+            m_pool.reserve(num_owners, sz);
+            m_staging.reset();
+            m_staging.resize(num_owners);
+        }
 
         solver& get_solver(unsigned i) { return *m_solvers[i]; }
 
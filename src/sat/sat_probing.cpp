@@ -151,6 +151,8 @@ namespace sat {
 
 #if 0
             // learn equivalences during probing:
+            // (when re-enabling this, call m_big.init(s, true) in operator()
+            // before the probing loop so that implies() has a current graph)
             if (implies(lit, l)) {
                 if (nullptr == find_binary_watch(s.get_wlist(lit), l) ||
                     nullptr == find_binary_watch(s.get_wlist(~l), ~lit)) {
@@ -242,7 +244,9 @@ namespace sat {
         bool r    = true;
         m_counter = 0;
         m_equivs.reset();
-        m_big.init(s, true);
+        // m_big is only consulted by implies(), which is used by the disabled
+        // equivalence learning in process_core. Building the implication graph
+        // costs a full pass over the watch lists, so only do it on demand.
         int limit = -static_cast<int>(m_probing_limit);
         unsigned i;
         unsigned num = s.num_vars();
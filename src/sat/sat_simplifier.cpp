@@ -396,7 +396,24 @@ namespace sat {
        Otherwise return false
     */
     bool simplifier::subsumes1(clause const & c1, clause const & c2, literal & l) {
-        for (literal lit : c2) 
+        // For short c1 it is cheaper to scan the flat literal array of c2 directly
+        // (the scans compile to packed 32-bit compares) than to mark and unmark
+        // every literal of c2 in the visited array.
+        if (c1.size() <= 4) {
+            l = null_literal;
+            for (literal lit : c1) {
+                if (c2.contains(lit))
+                    continue;
+                if (l == null_literal && c2.contains(~lit)) {
+                    l = ~lit;
+                    continue;
+                }
+                l = null_literal;
+                return false;
+            }
+            return true;
+        }
+        for (literal lit : c2)
             mark_visited(lit);
 
         bool r = true;
@@ -513,7 +530,13 @@ namespace sat {
        Otherwise return false
     */
     bool simplifier::subsumes0(clause const & c1, clause const & c2) {
-        for (literal l : c2) 
+        if (c1.size() <= 4) {
+            for (literal l : c1)
+                if (!c2.contains(l))
+                    return false;
+            return true;
+        }
+        for (literal l : c2)
             mark_visited(l);
 
         bool r = true;
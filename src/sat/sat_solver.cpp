@@ -106,6 +106,10 @@ namespace sat {
     }
 
     void solver::set_extension(extension* ext) {
+#ifdef Z3_COMPACT_CLAUSE_OFFSET
+        if (ext)
+            throw solver_exception("compact clause offsets are restricted to pure CNF solving");
+#endif
         m_ext = ext;
         if (ext) {
             ext->set_solver(this);
@@ -656,7 +660,16 @@ namespace sat {
 
     bool solver::should_defrag() {
         if (m_defrag_threshold > 0) --m_defrag_threshold;
-        return m_defrag_threshold == 0 && m_config.m_gc_defrag;
+        if (!m_config.m_gc_defrag)
+            return false;
+        if (m_defrag_threshold == 0)
+            return true;
+        // Chunks owned by the clause allocator are only returned wholesale when the
+        // surviving clauses are copied to the twin allocator. Force this bulk release
+        // when most of the arena sits on free lists after clause database reduction,
+        // so long-lived incremental solvers do not accumulate fragmented chunks.
+        size_t wasted = cls_allocator().get_wasted_size();
+        return wasted > (1 << 20) && wasted > cls_allocator().get_allocation_size();
     }
 
     void solver::defrag_clauses() {
@@ -919,15 +932,8 @@ namespace sat {
             }
         }
         
-        if (m_config.m_propagate_prefetch) {
-#if defined(__GNUC__) || defined(__clang__)
-            __builtin_prefetch((const char*)((m_watches[l.index()].data())));
-#else
-    #if !defined(_M_ARM) && !defined(_M_ARM64)
-            _mm_prefetch((const char*)((m_watches[l.index()].data())), _MM_HINT_T1);
-    #endif
-#endif
-        }
+        if (m_config.m_propagate_prefetch)
+            machine_prefetch(m_watches[l.index()].data());
 
         SASSERT(!l.sign() || !m_phase[v]);
         SASSERT(l.sign()  || m_phase[v]);
@@ -1026,6 +1032,7 @@ namespace sat {
         watch_list::iterator it = wlist.begin();
         watch_list::iterator it2 = it;
         watch_list::iterator end = wlist.end();
+        bool const prefetch = m_config.m_propagate_prefetch;
 #define CONFLICT_CLEANUP() {                    \
                 for (; it != end; ++it, ++it2)  \
                     *it2 = *it;                 \
@@ -1051,6 +1058,11 @@ namespace sat {
                 it2++;
                 break;
             case watched::CLAUSE: {
+                // The blocked literal is stored inline in the watch, so the test below
+                // often resolves the entry without touching the clause. Prefetch the
+                // clause of the next entry to hide the dependent load when it is needed.
+                if (prefetch && it + 1 != end && (it + 1)->is_clause())
+                    machine_prefetch(&get_clause((it + 1)->get_clause_offset()));
                 if (value(it->get_blocked_literal()) == l_true) {
                     TRACE(propagate_clause_bug, tout << "blocked literal " << it->get_blocked_literal() << "\n";
                     tout << get_clause(it) << "\n";);
@@ -1315,6 +1327,37 @@ namespace sat {
         }
     }
 
+    lbool solver::check_batch(vector<literal_vector> const& assumptions, svector<lbool>& results) {
+        results.reset();
+        results.resize(assumptions.size(), l_undef);
+        // Order the sets so that consecutive checks share the longest common
+        // assumption prefix. Consecutive checks then pop to the base level with
+        // a nearly identical trail, and saved phases, activities and learned
+        // clauses from the previous check stay maximally relevant.
+        unsigned_vector order;
+        for (unsigned i = 0; i < assumptions.size(); ++i)
+            order.push_back(i);
+        std::stable_sort(order.begin(), order.end(), [&](unsigned i, unsigned j) {
+            literal_vector const& a = assumptions[i];
+            literal_vector const& b = assumptions[j];
+            unsigned n = std::min(a.size(), b.size());
+            for (unsigned k = 0; k < n; ++k)
+                if (a[k] != b[k])
+                    return a[k] < b[k];
+            return a.size() < b.size();
+        });
+        bool all_decided = true;
+        for (unsigned i : order) {
+            if (!m_rlimit.inc()) {
+                all_decided = false;
+                break;
+            }
+            results[i] = check(assumptions[i].size(), assumptions[i].data());
+            all_decided &= results[i] != l_undef;
+        }
+        return all_decided ? l_true : l_undef;
+    }
+
     bool solver::should_cancel() {
         if (limit_reached() || memory_exceeded() || m_solver_canceled) {
             return true;
@@ -1483,11 +1526,14 @@ namespace sat {
 
            
         // set up ddfw search
+        ddfw_shared_best shared_best;
         for (int i = 0; i < num_ddfw; ++i) {
             ddfw_wrapper* d = alloc(ddfw_wrapper);
             d->updt_params(m_params);
             d->set_seed(m_config.m_random_seed + i);
             d->add(*this);
+            if (num_ddfw > 1)
+                d->set_shared_best(&shared_best);
             ls.push_back(d);
         }
         int local_search_offset = num_extra_solvers;
@@ -4023,6 +4069,102 @@ namespace sat {
         }
     }
 
+    // -----------------------
+    //
+    // Snapshots
+    //
+    // -----------------------
+
+    static const unsigned snapshot_magic   = 0x5a335353; // "Z3SS"
+    static const unsigned snapshot_version = 1;
+
+    static void snapshot_write(std::ostream& out, unsigned n) {
+        out.write(reinterpret_cast<char const*>(&n), sizeof(n));
+    }
+
+    static bool snapshot_read(std::istream& in, unsigned& n) {
+        in.read(reinterpret_cast<char*>(&n), sizeof(n));
+        return !in.fail();
+    }
+
+    void solver::save_snapshot(std::ostream& out) const {
+        snapshot_write(out, snapshot_magic);
+        snapshot_write(out, snapshot_version);
+        unsigned n = num_vars();
+        snapshot_write(out, n);
+        for (unsigned v = 0; v < n; ++v)
+            snapshot_write(out, m_activity[v]);
+        for (unsigned v = 0; v < n; ++v)
+            out.put(static_cast<char>((m_phase[v] ? 1 : 0) | (m_best_phase[v] ? 2 : 0)));
+        unsigned num_learned = 0;
+        for (clause* c : m_learned)
+            if (!c->was_removed())
+                ++num_learned;
+        snapshot_write(out, num_learned);
+        for (clause* c : m_learned) {
+            if (c->was_removed())
+                continue;
+            snapshot_write(out, c->size());
+            snapshot_write(out, c->glue());
+            for (literal l : *c)
+                snapshot_write(out, l.index());
+        }
+    }
+
+    bool solver::load_snapshot(std::istream& in) {
+        if (!at_base_lvl())
+            return false;
+        unsigned magic, version, n;
+        if (!snapshot_read(in, magic) || magic != snapshot_magic)
+            return false;
+        if (!snapshot_read(in, version) || version != snapshot_version)
+            return false;
+        if (!snapshot_read(in, n))
+            return false;
+        unsigned num_common = std::min(n, num_vars());
+        for (unsigned v = 0; v < n; ++v) {
+            unsigned act;
+            if (!snapshot_read(in, act))
+                return false;
+            if (v < num_common)
+                set_activity(v, act);
+        }
+        for (unsigned v = 0; v < n; ++v) {
+            int ch = in.get();
+            if (ch == EOF)
+                return false;
+            if (v < num_common) {
+                m_phase[v] = (ch & 1) != 0;
+                m_best_phase[v] = (ch & 2) != 0;
+            }
+        }
+        unsigned num_learned;
+        if (!snapshot_read(in, num_learned))
+            return false;
+        literal_vector lits;
+        for (unsigned i = 0; i < num_learned; ++i) {
+            unsigned sz, glue;
+            if (!snapshot_read(in, sz) || !snapshot_read(in, glue))
+                return false;
+            lits.reset();
+            bool usable = true;
+            for (unsigned j = 0; j < sz; ++j) {
+                unsigned idx;
+                if (!snapshot_read(in, idx))
+                    return false;
+                literal l = to_literal(idx);
+                usable &= l.var() < num_common && !was_eliminated(l.var());
+                lits.push_back(l);
+            }
+            if (usable && lits.size() >= 2) {
+                clause* c = mk_clause(lits.size(), lits.data(), status::redundant());
+                if (c)
+                    c->set_glue(glue);
+            }
+        }
+        return true;
+    }
+
     void solver::display_wcnf(std::ostream & out, unsigned sz, literal const* lits, unsigned const* weights) const {
         unsigned max_weight = 0;
         for (unsigned i = 0; i < sz; ++i) 
@@ -493,6 +493,13 @@ namespace sat {
         lbool check(unsigned num_lits = 0, literal const* lits = nullptr);
         lbool check(literal_vector const& lits) { return check(lits.size(), lits.data()); }
 
+        // Check a batch of assumption sets. The sets are processed in an order
+        // that maximizes shared assumption prefixes between consecutive checks,
+        // which amortizes propagation of the common prefix across the batch.
+        // results[i] holds the verdict for assumptions[i]; the return value is
+        // l_true if every check was decided and l_undef otherwise.
+        lbool check_batch(vector<literal_vector> const& assumptions, svector<lbool>& results);
+
         // retrieve model if solver return sat
         model const & get_model() const { return m_model; }
         bool model_is_current() const { return m_model_is_current; }
@@ -612,7 +619,8 @@ namespace sat {
         void gc_glue_psm();
         void gc_psm_glue();
         void save_psm();
-        void gc_half(char const * st_name);
+        unsigned gc_partition_core();
+        void gc_half(char const * st_name, unsigned start);
         void gc_dyn_psm();
         bool activate_frozen_clause(clause & c);
         unsigned psm(clause const & c) const;
@@ -834,6 +842,19 @@ namespace sat {
         clause_vector const& learned() const { return m_learned; }
 
 
+        // -----------------------
+        //
+        // Snapshots
+        //
+        // -----------------------
+    public:
+        // Serialize heuristic state (activities, saved phases) and the learned
+        // clause database, and seed a fresh solver from it for warm restarts
+        // on near-identical instances. Loading tolerates a different number of
+        // variables; clauses over unknown or eliminated variables are dropped.
+        void save_snapshot(std::ostream& out) const;
+        bool load_snapshot(std::istream& in);
+
         // -----------------------
         //
         // Debugging
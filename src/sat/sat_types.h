@@ -38,7 +38,16 @@ namespace sat {
 #define SAT_VB_LVL 10
 
 
+    // Z3_COMPACT_CLAUSE_OFFSET selects 32-bit arena-relative clause offsets on
+    // 64-bit builds. Watch and justification entries shrink accordingly, which
+    // roughly halves watch-list traffic on huge CNF instances. The mode
+    // addresses clauses through segment registration in clause_allocator and
+    // is restricted to pure CNF solving (no extensions).
+#ifdef Z3_COMPACT_CLAUSE_OFFSET
+    typedef unsigned clause_offset;
+#else
     typedef size_t clause_offset;
+#endif
     typedef size_t ext_constraint_idx;
     typedef size_t ext_justification_idx;
 
@@ -43,8 +43,8 @@ namespace sat {
             BINARY = 0, CLAUSE, EXT_CONSTRAINT
         };
     private:
-        size_t   m_val1;
-        unsigned m_val2; 
+        clause_offset m_val1;
+        unsigned      m_val2;
     public:
         watched(literal l, bool learned):
             m_val1(l.to_uint()),
@@ -67,7 +67,7 @@ namespace sat {
         }
 
         explicit watched(ext_constraint_idx cnstr_idx):
-            m_val1(cnstr_idx),
+            m_val1(static_cast<clause_offset>(cnstr_idx)),
             m_val2(static_cast<unsigned>(EXT_CONSTRAINT)) {
             SASSERT(is_ext_constraint());
             SASSERT(get_ext_constraint_idx() == cnstr_idx);
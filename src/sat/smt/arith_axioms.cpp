@@ -209,12 +209,12 @@ namespace arith {
         }
         if (get_config().m_arith_enum_const_mod && k.is_pos() && k < rational(8)) {
             unsigned _k = k.get_unsigned();
-            literal_vector lits;
+            sbuffer<literal> lits;
             for (unsigned j = 0; j < _k; ++j) {
                 literal mod_j = eq_internalize(mod, a.mk_int(j));
                 lits.push_back(mod_j);
             }
-            add_clause(lits);
+            add_clause(lits.size(), lits.data(), nullptr);
         }
     }
 
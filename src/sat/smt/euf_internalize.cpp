@@ -232,7 +232,7 @@ namespace euf {
 
         static const unsigned distinct_max_args = 32;
         if (sz <= distinct_max_args) {
-            sat::literal_vector lits;
+            sbuffer<sat::literal> lits;
             for (unsigned i = 0; i < sz; ++i) {
                 for (unsigned j = i + 1; j < sz; ++j) {
                     expr_ref eq = mk_eq(args[i]->get_expr(), args[j]->get_expr());
@@ -240,8 +240,8 @@ namespace euf {
                     lits.push_back(lit);
                 }
             }
-            add_root(lits);
-            s().mk_clause(lits, mk_distinct_status(lits));
+            add_root(lits.size(), lits.data());
+            s().mk_clause(lits.size(), lits.data(), mk_distinct_status(lits.size(), lits.data()));
         }
         else {
             // g(f(x_i)) = x_i
@@ -859,23 +859,23 @@ namespace euf {
             break;
         }
         case OP_OR: {
-            sat::literal_vector lits;
+            sbuffer<sat::literal> lits;
             for (expr* arg : *to_app(e))
                 lits.push_back(si.internalize(arg));
             for (auto lit2 : lits)
                 add_aux(~lit2, lit);
             lits.push_back(~lit);
-            add_aux(lits);
+            add_aux(lits.size(), lits.data());
             break;
         }
         case OP_AND: {
-            sat::literal_vector lits;
+            sbuffer<sat::literal> lits;
             for (expr* arg : *to_app(e))
                 lits.push_back(~si.internalize(arg));
             for (auto nlit2 : lits)
                 add_aux(~lit, ~nlit2);
             lits.push_back(lit);
-            add_aux(lits);
+            add_aux(lits.size(), lits.data());
             break;
         }
         case OP_TRUE:
@@ -1941,11 +1941,19 @@ namespace pb {
         VERIFY(index <= bound);
         VERIFY(c[index] == alit);
         
-        // find a literal to swap with:
-        for (unsigned i = bound + 1; i < sz; ++i) {
+        // find a literal to swap with; resume the scan where the previous
+        // search stopped (wrapping around) so long runs of false literals in
+        // the tail are not rescanned on every watch event.
+        unsigned start = c.scan_idx();
+        if (start <= bound || start >= sz)
+            start = bound + 1;
+        for (unsigned n = sz - bound - 1, i = start; n-- > 0; ++i) {
+            if (i == sz)
+                i = bound + 1;
             literal lit2 = c[i];
             if (value(lit2) != l_false) {
                 c.swap(index, i);
+                c.set_scan_idx(i + 1);
                 c.watch_literal(*this, lit2);
                 return l_undef;
             }
@@ -303,6 +303,12 @@ namespace q {
         if (m_bindings.contains(b))
             return nullptr;
 
+        mk_fingerprint(c, b->m_nodes, m_tmp_fingerprint);
+        if (m_fingerprints.contains(m_tmp_fingerprint)) {
+            ++m_stats.m_num_fingerprint_hits;
+            return nullptr;
+        }
+
         unsigned n = c.num_decls();
         unsigned sz = sizeof(binding) + sizeof(euf::enode* const*) * n;
         void* mem = ctx.get_region().allocate(sz);
@@ -390,9 +396,32 @@ namespace q {
             lits.push_back(instantiate(j.m_clause, j.m_generation, j.m_binding, j.m_clause[i])); 
         m_qs.log_instantiation(lits, &j);
         euf::th_proof_hint* ph = nullptr;
-        if (ctx.use_drat()) 
+        if (ctx.use_drat())
             ph = q_proof_hint::mk(ctx, m_ematch, j.m_generation, lits, j.m_clause.num_decls(), j.m_binding);
-        m_qs.add_clause(lits, ph);               
+        m_qs.add_clause(lits, ph);
+        mk_fingerprint(j.m_clause, j.m_binding, m_tmp_fingerprint);
+        m_fingerprints.insert(m_tmp_fingerprint);
+    }
+
+    /**
+       The fingerprint identifies an instantiation by the quantifier and the
+       congruence roots of the binding. The clause produced for it stays in
+       the solver for the rest of the search, so re-deriving the same binding
+       after a restart or backjump is redundant even though the trailed
+       binding table has been unwound. Roots can differ between the time an
+       instantiation is recorded and the time a duplicate is proposed; that
+       only costs a missed hit, never a wrongly skipped instance.
+    */
+    void ematch::mk_fingerprint(clause& c, euf::enode* const* binding, unsigned_vector& out) {
+        out.reset();
+        out.push_back(c.q()->get_id());
+        for (unsigned i = 0; i < c.num_decls(); ++i)
+            out.push_back(binding[i]->get_root()->get_expr_id());
+    }
+
+    void ematch::init_search() {
+        // instantiation clauses from a previous query may have been popped.
+        m_fingerprints.reset();
     }
 
     bool ematch::flush_prop_queue() {
@@ -706,6 +735,7 @@ namespace q {
         st.update("q unit propagations",     m_stats.m_num_propagations);
         st.update("q conflicts", m_stats.m_num_conflicts);
         st.update("q delayed bindings", m_stats.m_num_delayed_bindings);
+        st.update("q fingerprint hits", m_stats.m_num_fingerprint_hits);
     }
 
     std::ostream& ematch::display(std::ostream& out) const {
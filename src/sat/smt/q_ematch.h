@@ -42,6 +42,7 @@ namespace q {
             unsigned m_num_conflicts;
             unsigned m_num_redundant;
             unsigned m_num_delayed_bindings;
+            unsigned m_num_fingerprint_hits;
             
             stats() { reset(); }
 
@@ -89,9 +90,17 @@ namespace q {
         unsigned                      m_qhead = 0;
         unsigned_vector               m_clause_queue;
         euf::enode_pair_vector        m_evidence;
+        // Fingerprints of instantiations that were added as clauses.
+        // The clauses survive restarts and backtracking, so the set is not
+        // trailed; it is reset when a new search starts.
+        typedef hashtable<unsigned_vector, svector_hash<unsigned_hash>, default_eq<unsigned_vector>> fingerprint_set;
+        fingerprint_set               m_fingerprints;
+        unsigned_vector               m_tmp_fingerprint;
         bool                          m_enable_propagate = true;
         symbol                        m_ematch = symbol("ematch");
 
+        void mk_fingerprint(clause& c, euf::enode* const* binding, unsigned_vector& out);
+
         euf::enode* const* copy_nodes(clause& c, euf::enode* const* _binding);
         binding* tmp_binding(clause& c, app* pat, euf::enode* const* _binding);
         binding* alloc_binding(clause& c, app* pat, euf::enode* const* _binding, unsigned max_generation, unsigned min_top, unsigned max_top);
@@ -138,7 +147,9 @@ namespace q {
             
         bool operator()();
 
-        bool unit_propagate();        
+        bool unit_propagate();
+
+        void init_search();
 
         void add(quantifier* q);
 
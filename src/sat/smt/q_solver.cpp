@@ -160,6 +160,7 @@ namespace q {
 
     void solver::init_search() {
         m_mbqi.init_search();
+        m_ematch.init_search();
     }
 
     sat::literal solver::internalize(expr* e, bool sign, bool root) {
@@ -32,8 +32,9 @@ namespace recfun {
         m_util(m_plugin.u()), 
         m_disabled_guards(m),
         m_enabled_guards(m),
-        m_preds(m) {
-    }    
+        m_preds(m),
+        m_expanded_pinned(m) {
+    }
 
     solver::~solver() {
         reset();
@@ -44,7 +45,9 @@ namespace recfun {
         m_disabled_guards.reset();
         m_enabled_guards.reset();
         m_propagation_queue.reset();
-        for (auto & kv : m_guard2pending) 
+        m_expanded.reset();
+        m_expanded_pinned.reset();
+        for (auto & kv : m_guard2pending)
             dealloc(kv.m_value);
         m_guard2pending.reset();
     }
@@ -108,7 +111,8 @@ namespace recfun {
                 guards.push_back(apply_args(vars, e.m_args, g));
             if (c.is_immediate()) {
                 body_expansion be(pred_applied, c, e.m_args);
-                assert_body_axiom(be);            
+                mark_expanded(pred_applied);
+                assert_body_axiom(be);
             }
             else if (!is_enabled_guard(pred_applied)) {
                 disable_guard(pred_applied, guards);
@@ -202,6 +206,7 @@ namespace recfun {
         st.update("recfun macro expansion", m_stats.m_macro_expansions);
         st.update("recfun case expansion", m_stats.m_case_expansions);
         st.update("recfun body expansion", m_stats.m_body_expansions);
+        st.update("recfun expansion cache hits", m_stats.m_expansion_cache_hits);
     }
 
     euf::th_solver* solver::clone(euf::solver& ctx) {
@@ -215,14 +220,28 @@ namespace recfun {
         ctx.push(value_trail<unsigned>(m_qhead));
         for (; m_qhead < m_propagation_queue.size() && !s().inconsistent(); ++m_qhead) {
             auto& p = *m_propagation_queue[m_qhead];
-            if (p.is_guard()) 
+            if (p.is_guard())
                 assert_guard(p.guard(), *m_guard2pending[p.guard()]);
-            else if (p.is_core()) 
+            else if (p.is_core())
                 block_core(p.core());
-            else if (p.is_case()) 
-                assert_case_axioms(p.case_ex());
-            else 
-                assert_body_axiom(p.body());
+            else if (p.is_case()) {
+                expr* lhs = p.case_ex().m_lhs;
+                if (is_expanded(lhs))
+                    ++m_stats.m_expansion_cache_hits;
+                else {
+                    mark_expanded(lhs);
+                    assert_case_axioms(p.case_ex());
+                }
+            }
+            else {
+                expr* pred = p.body().m_pred;
+                if (is_expanded(pred))
+                    ++m_stats.m_expansion_cache_hits;
+                else {
+                    mark_expanded(pred);
+                    assert_body_axiom(p.body());
+                }
+            }
         }
         return true;
     }
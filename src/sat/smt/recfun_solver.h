@@ -31,7 +31,7 @@ namespace recfun {
     class solver : public euf::th_euf_solver {
 
         struct stats {
-            unsigned m_case_expansions, m_body_expansions, m_macro_expansions;
+            unsigned m_case_expansions, m_body_expansions, m_macro_expansions, m_expansion_cache_hits;
             void reset() { memset(this, 0, sizeof(stats)); }
             stats() { reset(); }
         };
@@ -52,6 +52,17 @@ namespace recfun {
         scoped_ptr_vector<propagation_item> m_propagation_queue;
         unsigned                            m_qhead { 0 };
 
+        // Expansion axioms are permanent for the duration of a search, but the
+        // propagation queue is unwound on backjumps and expansion requests are
+        // replayed when terms are re-internalized. Remember which terms were
+        // already expanded so identical expansions are not recomputed.
+        // The cache is reset between searches.
+        obj_hashtable<expr>                 m_expanded;
+        expr_ref_vector                     m_expanded_pinned;
+
+        bool is_expanded(expr* e) const { return m_expanded.contains(e); }
+        void mark_expanded(expr* e) { m_expanded.insert(e); m_expanded_pinned.push_back(e); }
+
         void push_body_expand(expr* e) { push_prop(alloc(propagation_item, alloc(body_expansion, u(), to_app(e)))); }
         void push_case_expand(expr* e) { push_prop(alloc(propagation_item, alloc(case_expansion, u(), to_app(e)))); }
         void push_guard(expr* e) { push_prop(alloc(propagation_item, e)); }
@@ -106,7 +117,7 @@ namespace recfun {
         bool add_dep(euf::enode* n, top_sort<euf::enode>& dep) override;
         void add_value(euf::enode* n, model& mdl, expr_ref_vector& values) override;
         bool is_shared(euf::theory_var v) const override { return true; }
-        void init_search() override {}
+        void init_search() override { m_expanded.reset(); m_expanded_pinned.reset(); }
         bool should_research(sat::literal_vector const& core) override;
         bool is_beta_redex(euf::enode* p, euf::enode* n) const override;
         void add_assumptions(sat::literal_set& assumptions) override;
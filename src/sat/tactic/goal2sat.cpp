@@ -272,6 +272,12 @@ struct goal2sat::imp : public sat::sat_internalizer {
         m_app2lit.insert(t, l);
         m_lit2app.insert(l.index(), t);
         m_cache_trail.push_back(t);
+        if (m_default_external)
+            // the entry survives into later assertion batches, so protect the
+            // definition variable from being eliminated by in-processing in
+            // between; atoms are kept external in incremental mode for the
+            // same reason.
+            m_solver.set_external(l.var());
     }
 
     sat::literal get_cached(app* t) const override {
@@ -920,8 +926,13 @@ struct goal2sat::imp : public sat::sat_internalizer {
         scoped_reset(imp& i) :i(i) {}
         ~scoped_reset() {
             i.m_interface_vars.reset();
-            i.m_app2lit.reset();
-            i.m_lit2app.reset();
+            // in incremental mode the solver and its clauses persist across
+            // invocations, so the Tseitin definitions stay valid: keep them
+            // and let pop()/uncache() invalidate entries that actually die.
+            if (!i.m_default_external) {
+                i.m_app2lit.reset();
+                i.m_lit2app.reset();
+            }
         }
     };
     
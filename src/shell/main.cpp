@@ -18,6 +18,7 @@ Revision History:
 
 --*/
 #include<iostream>
+#include<fstream>
 #include "util/memory_manager.h"
 #include "util/trace.h"
 #include "util/debug.h"
@@ -46,6 +47,7 @@ Revision History:
 typedef enum { IN_UNSPECIFIED, IN_SMTLIB_2, IN_DATALOG, IN_DIMACS, IN_WCNF, IN_OPB, IN_LP, IN_Z3_LOG, IN_DRAT } input_kind;
 
 static char const * g_input_file          = nullptr;
+static char const * g_batch_input_file    = nullptr;
 static char const * g_drat_input_file     = nullptr;
 static bool         g_standard_input      = false;
 static input_kind   g_input_kind          = IN_UNSPECIFIED;
@@ -85,6 +87,7 @@ void display_usage() {
     std::cout << "  -lp         use parser for a modest subset of CPLEX LP input format.\n";
     std::cout << "  -log        use parser for Z3 log input format.\n";
     std::cout << "  -in         read formula from standard input.\n";
+    std::cout << "  -batch:file read SMT 2 file names from <file>, one per line, and process them in a single process. Each job runs in a fresh context; outputs are concatenated in job order.\n";
     std::cout << "  -model      display model for satisfiable SMT.\n";
     std::cout << "\nMiscellaneous:\n";
     std::cout << "  -h, -?      prints this message.\n";
@@ -235,6 +238,11 @@ static void parse_cmd_line_args(std::string& input_file, int argc, char ** argv)
             else if (strcmp(opt_name, "file") == 0) {
                 g_input_file = opt_arg;
             }
+            else if (strcmp(opt_name, "batch") == 0) {
+                if (!opt_arg)
+                    error("option argument (-batch:file) is missing.");
+                g_batch_input_file = opt_arg;
+            }
             else if (strcmp(opt_name, "T") == 0) {
                 if (!opt_arg)
                     error("option argument (-T:timeout) is missing.");
@@ -355,6 +363,31 @@ int STD_CALL main(int argc, char ** argv) {
         parse_cmd_line_args(input_file, argc, argv);
         env_params::updt_params();
 
+        if (g_batch_input_file) {
+            // Amortize process startup (plugin registration, parameter
+            // parsing, allocator warmup) over many short jobs. Each job is
+            // served from a fresh cmd_context, so jobs are isolated and the
+            // soft timeout (-t) still applies per query.
+            if (g_input_file || g_standard_input)
+                error("batch mode cannot be combined with another input source.");
+            if (g_input_kind != IN_UNSPECIFIED && g_input_kind != IN_SMTLIB_2)
+                error("batch mode only processes SMT 2 jobs.");
+            memory::exit_when_out_of_memory(true, "(error \"out of memory\")");
+            std::ifstream jobs(g_batch_input_file);
+            if (jobs.bad() || jobs.fail())
+                error("failed to open batch file.");
+            std::string job;
+            while (std::getline(jobs, job)) {
+                if (job.empty())
+                    continue;
+                unsigned rv = read_smtlib2_commands(job.c_str());
+                if (rv != 0)
+                    return_value = rv;
+            }
+            disable_timeout();
+            memory::finalize();
+            return return_value;
+        }
         if (g_input_file && g_standard_input) {
             error("using standard input to read formula.");
         }
@@ -25,6 +25,7 @@ Revision History:
 #include "util/mutex.h"
 #include "parsers/smt2/smt2parser.h"
 #include "muz/fp/dl_cmds.h"
+#include "cmd_context/extra_cmds/ast_binary_cmds.h"
 #include "cmd_context/extra_cmds/dbg_cmds.h"
 #include "cmd_context/extra_cmds/proof_cmds.h"
 #include "opt/opt_cmds.h"
@@ -163,6 +164,7 @@ unsigned read_smtlib2_commands(char const * file_name) {
     ctx.set_solver_factory(mk_smt_strategic_solver_factory());
     install_dl_cmds(ctx);
     install_dbg_cmds(ctx);
+    install_ast_binary_cmds(ctx);
     install_polynomial_cmds(ctx);
     install_subpaving_cmds(ctx);
     install_opt_cmds(ctx);
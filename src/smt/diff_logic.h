@@ -390,10 +390,15 @@ private:
                 if (!e.is_enabled()) {
                     continue;
                 }
+                target = e.get_target();
+                if (m_mark[target] == DL_PROCESSED) {
+                    // target is settled at its final value; skip before the
+                    // (comparatively expensive) numeral arithmetic below.
+                    continue;
+                }
                 set_gamma(e, gamma);
-                
+
                 if (gamma.is_neg()) {
-                    target   = e.get_target();
                     switch (m_mark[target]) {
                     case DL_UNMARKED:
                         m_gamma[target]  = gamma;
@@ -410,10 +415,6 @@ private:
                             m_heap.decreased(target);
                         }
                         break;
-                    case DL_PROCESSED:
-                        TRACE(arith, display_edge(tout << "processed twice: ", e););
-                        // if two edges with the same source/target occur in the graph.
-                        break;
                     default:
                         UNREACHABLE();
                     }
@@ -732,6 +733,11 @@ public:
                 if (!e.is_enabled()) {
                     continue;
                 }
+                if (e.get_timestamp() >= timestamp) {
+                    // is_connected would reject the edge; skip before the
+                    // numeral arithmetic in set_gamma.
+                    continue;
+                }
                 set_gamma(e, gamma);
                 if (is_connected(gamma, zero_edge, e, timestamp)) {
                     dl_var curr_target = e.get_target();
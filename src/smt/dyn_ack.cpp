@@ -194,6 +194,7 @@ namespace smt {
         reset_app_triples();
         m_triple.m_to_instantiate.reset();
         m_triple.m_qhead = 0;
+        m_occ_inc = 1.0;
     }
 
     void dyn_ack_manager::cg_eh(app * n1, app * n2) {
@@ -209,24 +210,20 @@ namespace smt {
         if (m_instantiated.contains(p)) {
             return;
         }
-        unsigned num_occs = 0;
+        double num_occs = 0.0;
+        double threshold = m_params.m_dack_threshold * m_occ_inc;
         if (m_app_pair2num_occs.find(n1, n2, num_occs)) {
             TRACE(dyn_ack, tout << "used_cg_eh:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\nnum_occs: " << num_occs << "\n";);
-            num_occs++;
         }
         else {
-            num_occs = 1;
             m.inc_ref(n1);
             m.inc_ref(n2);
             m_app_pairs.push_back(p);
         }
-        SASSERT(num_occs > 0);
+        bool was_candidate = num_occs >= threshold;
+        num_occs += m_occ_inc;
         m_app_pair2num_occs.insert(n1, n2, num_occs);
-#ifdef Z3DEBUG
-        unsigned num_occs2 = 0;
-        SASSERT(m_app_pair2num_occs.find(n1, n2, num_occs2) && num_occs == num_occs2);
-#endif
-        if (num_occs == m_params.m_dack_threshold) {
+        if (!was_candidate && num_occs >= threshold) {
             TRACE(dyn_ack, tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\nnum_occs: " << num_occs << "\n";);
             m_to_instantiate.push_back(p);
         }
@@ -244,58 +241,43 @@ namespace smt {
         if (m_triple.m_instantiated.contains(tr)) {
             return;
         }
-        unsigned num_occs = 0;
+        double num_occs = 0.0;
+        double threshold = m_params.m_dack_threshold * m_occ_inc;
         if (m_triple.m_app2num_occs.find(n1, n2, r, num_occs)) {
             TRACE(dyn_ack, tout << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\n"
                   << mk_pp(r, m) << "\n" << "\nnum_occs: " << num_occs << "\n";);
-            num_occs++;
         }
         else {
-            num_occs = 1;
             m.inc_ref(n1);
             m.inc_ref(n2);
             m.inc_ref(r);
             m_triple.m_apps.push_back(tr);
         }
-        SASSERT(num_occs > 0);
+        bool was_candidate = num_occs >= threshold;
+        num_occs += m_occ_inc;
         m_triple.m_app2num_occs.insert(n1, n2, r, num_occs);
-#ifdef Z3DEBUG
-        unsigned num_occs2 = 0;
-        SASSERT(m_triple.m_app2num_occs.find(n1, n2, r, num_occs2) && num_occs == num_occs2);
-#endif
-        if (num_occs == m_params.m_dack_threshold) {
-            TRACE(dyn_ack, tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) 
-                  << "\n" << mk_pp(r, m) 
+        if (!was_candidate && num_occs >= threshold) {
+            TRACE(dyn_ack, tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m)
+                  << "\n" << mk_pp(r, m)
                   << "\nnum_occs: " << num_occs << "\n";);
             m_triple.m_to_instantiate.push_back(tr);
         }
-        
-    }
 
-    struct app_pair_lt { 
-        typedef std::pair<app *, app *>          app_pair;
-        typedef obj_pair_map<app, app, unsigned> app_pair2num_occs;
-        app_pair2num_occs &  m_app_pair2num_occs;
-        
-        app_pair_lt(app_pair2num_occs & m):
-            m_app_pair2num_occs(m) {
-        }
-        
-        bool operator()(app_pair const & p1, app_pair const & p2) const {
-            unsigned n1 = 0;
-            unsigned n2 = 0;
-            m_app_pair2num_occs.find(p1.first, p1.second, n1);
-            m_app_pair2num_occs.find(p2.first, p2.second, n2);
-            SASSERT(n1 > 0);
-            SASSERT(n2 > 0);
-            return n1 > n2;
-        }
-    };
+    }
 
+    /**
+       \brief Rare rescaling sweep. Decay itself is O(1): it scales up
+       m_occ_inc instead of touching the tables, so this sweep only runs when
+       the increment threatens the dynamic range of a double. It divides the
+       stored counts by the current increment, drops entries whose decayed
+       count is at most one, and drops leftovers of instantiated pairs.
+    */
     void dyn_ack_manager::gc() {
         TRACE(dyn_ack, tout << "dyn_ack GC\n";);
-        m_to_instantiate.reset();
-        m_qhead = 0;
+        // Deleted pairs keep their references until the candidate queues have
+        // been purged of them; the queue filters dereference the pairs.
+        app_pair_vector   deleted_pairs;
+        app_triple_vector deleted_triples;
         svector<app_pair>::iterator it  = m_app_pairs.begin();
         svector<app_pair>::iterator end = m_app_pairs.end();
         svector<app_pair>::iterator it2 = it;
@@ -303,38 +285,77 @@ namespace smt {
             app_pair & p = *it;
             if (m_instantiated.contains(p)) {
                 TRACE(dyn_ack, tout << "1) erasing:\n" << mk_pp(p.first, m) << "\n" << mk_pp(p.second, m) << "\n";);
-                m.dec_ref(p.first);
-                m.dec_ref(p.second);
                 SASSERT(!m_app_pair2num_occs.contains(p.first, p.second));
+                deleted_pairs.push_back(p);
                 continue;
             }
-            unsigned num_occs = 0;
+            double num_occs = 0.0;
             m_app_pair2num_occs.find(p.first, p.second, num_occs);
-            // The following invariant is not true. p.first and
-            // p.second may have been instantiated, and removed from
-            // m_app_pair2num_occs, but not from m_app_pairs.
-            //
-            // SASSERT(num_occs > 0);
-            num_occs = static_cast<unsigned>(num_occs * m_params.m_dack_gc_inv_decay);
-            if (num_occs <= 1) {
+            num_occs /= m_occ_inc;
+            if (num_occs <= 1.0) {
                 TRACE(dyn_ack, tout << "2) erasing:\n" << mk_pp(p.first, m) << "\n" << mk_pp(p.second, m) << "\n";);
                 m_app_pair2num_occs.erase(p.first, p.second);
-                m.dec_ref(p.first);
-                m.dec_ref(p.second);
+                deleted_pairs.push_back(p);
                 continue;
             }
             *it2 = p;
             ++it2;
-            SASSERT(num_occs > 0);
             m_app_pair2num_occs.insert(p.first, p.second, num_occs);
-            if (num_occs >= m_params.m_dack_threshold)
-                m_to_instantiate.push_back(p);
         }
         m_app_pairs.set_end(it2);
-        app_pair_lt f(m_app_pair2num_occs);
-        // app_pair_lt is not a total order on pairs of expressions.
-        // So, we should use stable_sort to avoid different behavior in different platforms.
-        std::stable_sort(m_to_instantiate.begin(), m_to_instantiate.end(), f);
+
+        svector<app_triple>::iterator it3  = m_triple.m_apps.begin();
+        svector<app_triple>::iterator end3 = m_triple.m_apps.end();
+        svector<app_triple>::iterator it4  = it3;
+        for (; it3 != end3; ++it3) {
+            app_triple & p = *it3;
+            if (m_triple.m_instantiated.contains(p)) {
+                SASSERT(!m_triple.m_app2num_occs.contains(p.first, p.second, p.third));
+                deleted_triples.push_back(p);
+                continue;
+            }
+            double num_occs = 0.0;
+            m_triple.m_app2num_occs.find(p.first, p.second, p.third, num_occs);
+            num_occs /= m_occ_inc;
+            if (num_occs <= 1.0) {
+                m_triple.m_app2num_occs.erase(p.first, p.second, p.third);
+                deleted_triples.push_back(p);
+                continue;
+            }
+            *it4 = p;
+            ++it4;
+            m_triple.m_app2num_occs.insert(p.first, p.second, p.third, num_occs);
+        }
+        m_triple.m_apps.set_end(it4);
+
+        // purge queue entries of deleted pairs before releasing the references.
+        unsigned j = 0;
+        for (unsigned i = m_qhead; i < m_to_instantiate.size(); ++i) {
+            app_pair p = m_to_instantiate[i];
+            if (!m_instantiated.contains(p) && m_app_pair2num_occs.contains(p.first, p.second))
+                m_to_instantiate[j++] = p;
+        }
+        m_to_instantiate.shrink(j);
+        m_qhead = 0;
+        j = 0;
+        for (unsigned i = m_triple.m_qhead; i < m_triple.m_to_instantiate.size(); ++i) {
+            app_triple tr = m_triple.m_to_instantiate[i];
+            if (!m_triple.m_instantiated.contains(tr) && m_triple.m_app2num_occs.contains(tr.first, tr.second, tr.third))
+                m_triple.m_to_instantiate[j++] = tr;
+        }
+        m_triple.m_to_instantiate.shrink(j);
+        m_triple.m_qhead = 0;
+
+        for (app_pair & p : deleted_pairs) {
+            m.dec_ref(p.first);
+            m.dec_ref(p.second);
+        }
+        for (app_triple & p : deleted_triples) {
+            m.dec_ref(p.first);
+            m.dec_ref(p.second);
+            m.dec_ref(p.third);
+        }
+        m_occ_inc = 1.0;
     }
 
     class dyn_ack_clause_del_eh : public clause_del_eh {
@@ -374,19 +395,29 @@ namespace smt {
             return;
         m_num_propagations_since_last_gc++;
         if (m_num_propagations_since_last_gc > m_params.m_dack_gc) {
-            gc();
+            // decay all occurrence counts in O(1) by scaling up the increment.
+            if (m_params.m_dack_gc_inv_decay > 0.0)
+                m_occ_inc *= 1.0 / m_params.m_dack_gc_inv_decay;
+            if (m_occ_inc > 1e10 || m_occ_inc < 1e-10)
+                gc();
             m_num_propagations_since_last_gc = 0;
         }
         unsigned max_instances  = static_cast<unsigned>(m_context.get_num_conflicts() * m_params.m_dack_factor);
         while (m_num_instances < max_instances && m_qhead < m_to_instantiate.size()) {
             app_pair & p = m_to_instantiate[m_qhead];
             m_qhead++;
+            // stale entry: the pair crossed the threshold again after it was
+            // already queued or instantiated.
+            if (m_instantiated.contains(p) || !m_app_pair2num_occs.contains(p.first, p.second))
+                continue;
             m_num_instances++;
             instantiate(p.first, p.second);
         }
         while (m_num_instances < max_instances && m_triple.m_qhead < m_triple.m_to_instantiate.size()) {
             app_triple & p = m_triple.m_to_instantiate[m_triple.m_qhead];
             m_triple.m_qhead++;
+            if (m_triple.m_instantiated.contains(p) || !m_triple.m_app2num_occs.contains(p.first, p.second, p.third))
+                continue;
             m_num_instances++;
             instantiate(p.first, p.second, p.third);
         }
@@ -500,73 +531,6 @@ namespace smt {
     }
 
 
-    struct app_triple_lt { 
-        typedef triple<app *, app *, app*>          app_triple;
-        typedef obj_triple_map<app, app, app, unsigned> app_triple2num_occs;
-        app_triple2num_occs &  m_app_triple2num_occs;
-        
-        app_triple_lt(app_triple2num_occs & m):
-            m_app_triple2num_occs(m) {
-        }
-        
-        bool operator()(app_triple const & p1, app_triple const & p2) const {
-            unsigned n1 = 0;
-            unsigned n2 = 0;
-            m_app_triple2num_occs.find(p1.first, p1.second, p1.third, n1);
-            m_app_triple2num_occs.find(p2.first, p2.second, p2.third, n2);
-            SASSERT(n1 > 0);
-            SASSERT(n2 > 0);
-            return n1 > n2;
-        }
-    };
-
-    void dyn_ack_manager::gc_triples() {
-        TRACE(dyn_ack, tout << "dyn_ack GC\n";);
-        m_triple.m_to_instantiate.reset();
-        m_triple.m_qhead = 0;
-        svector<app_triple>::iterator it  = m_triple.m_apps.begin();
-        svector<app_triple>::iterator end = m_triple.m_apps.end();
-        svector<app_triple>::iterator it2 = it;
-        for (; it != end; ++it) {
-            app_triple & p = *it;
-            if (m_triple.m_instantiated.contains(p)) {
-                TRACE(dyn_ack, tout << "1) erasing:\n" << mk_pp(p.first, m) << "\n" << mk_pp(p.second, m) << "\n";);
-                m.dec_ref(p.first);
-                m.dec_ref(p.second);
-                m.dec_ref(p.third);
-                SASSERT(!m_triple.m_app2num_occs.contains(p.first, p.second, p.third));
-                continue;
-            }
-            unsigned num_occs = 0;
-            m_triple.m_app2num_occs.find(p.first, p.second, p.third, num_occs);
-            // The following invariant is not true. p.first and
-            // p.second may have been instantiated, and removed from
-            // m_app_triple2num_occs, but not from m_app_triples.
-            //
-            // SASSERT(num_occs > 0);
-            num_occs = static_cast<unsigned>(num_occs * m_params.m_dack_gc_inv_decay);
-            if (num_occs <= 1) {
-                TRACE(dyn_ack, tout << "2) erasing:\n" << mk_pp(p.first, m) << "\n" << mk_pp(p.second, m) << "\n";);
-                m_triple.m_app2num_occs.erase(p.first, p.second, p.third);
-                m.dec_ref(p.first);
-                m.dec_ref(p.second);
-                m.dec_ref(p.third);
-                continue;
-            }
-            *it2 = p;
-            ++it2;
-            SASSERT(num_occs > 0);
-            m_triple.m_app2num_occs.insert(p.first, p.second, p.third, num_occs);
-            if (num_occs >= m_params.m_dack_threshold)
-                m_triple.m_to_instantiate.push_back(p);
-        }
-        m_triple.m_apps.set_end(it2);
-        app_triple_lt f(m_triple.m_app2num_occs);
-        // app_triple_lt is not a total order
-        std::stable_sort(m_triple.m_to_instantiate.begin(), m_triple.m_to_instantiate.end(), f);
-    }
-
-
 
 #ifdef Z3DEBUG
     bool dyn_ack_manager::check_invariant() const {
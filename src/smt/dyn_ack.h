@@ -31,13 +31,13 @@ namespace smt {
 
     class dyn_ack_manager {
         typedef std::pair<app *, app *>           app_pair;
-        typedef obj_pair_map<app, app, unsigned>  app_pair2num_occs;
+        typedef obj_pair_map<app, app, double>    app_pair2num_occs;
         typedef svector<app_pair>                 app_pair_vector;
         typedef obj_pair_hashtable<app, app>      app_pair_set;
         typedef obj_map<clause, app_pair>         clause2app_pair;
 
         typedef triple<app *, app *,app *>        app_triple;
-        typedef obj_triple_map<app, app, app, unsigned>  app_triple2num_occs;
+        typedef obj_triple_map<app, app, app, double>    app_triple2num_occs;
         typedef svector<app_triple>                 app_triple_vector;
         typedef obj_triple_hashtable<app, app, app>      app_triple_set;
         typedef obj_map<clause, app_triple>         clause2app_triple;
@@ -51,6 +51,10 @@ namespace smt {
         unsigned                                   m_qhead;
         unsigned                                   m_num_instances;
         unsigned                                   m_num_propagations_since_last_gc;
+        // Occurrence counts are decayed by scaling up the increment instead of
+        // sweeping the tables; entries are rescaled and pruned only when the
+        // increment threatens the dynamic range of a double.
+        double                                     m_occ_inc = 1.0;
         app_pair_set                               m_instantiated;
         clause2app_pair                            m_clause2app_pair;
 
@@ -79,8 +83,7 @@ namespace smt {
         void eq_eh(app * n1, app * n2, app* r);
         void instantiate(app * n1, app * n2, app* r);
         void reset_app_triples();
-        void gc_triples();
-        
+
     public:
         dyn_ack_manager(context & ctx, dyn_ack_params & p);
         ~dyn_ack_manager();
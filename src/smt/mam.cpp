@@ -19,6 +19,8 @@ Revision History:
 #include <algorithm>
 
 #include "util/pool.h"
+#include "util/map.h"
+#include "util/machine.h"
 #include "util/trail.h"
 #include "util/stopwatch.h"
 #include "ast/ast_pp.h"
@@ -387,6 +389,8 @@ namespace {
         unsigned                   m_num_choices;
         instruction *              m_root;
         enode_vector               m_candidates;
+        unsigned                   m_candidate_gen = 0; //!< current match round, used to deduplicate candidates.
+        u_map<unsigned>            m_candidate_stamp; //!< enode id -> match round at which it was last queued.
 #ifdef Z3DEBUG
         context *                  m_context;
         ptr_vector<app>            m_patterns;
@@ -527,6 +531,15 @@ namespace {
         }
 
         void add_candidate(enode * n) {
+            // The same enode is frequently rediscovered by several label pairs of
+            // the same merge (and by several merges in the same propagation round).
+            // Each duplicate would trigger a full code tree execution, so stamp
+            // candidates with the current match round and queue them only once.
+            unsigned id = n->get_owner_id();
+            unsigned gen;
+            if (m_candidate_stamp.find(id, gen) && gen == m_candidate_gen)
+                return;
+            m_candidate_stamp.insert(id, m_candidate_gen);
             m_candidates.push_back(n);
         }
 
@@ -536,6 +549,13 @@ namespace {
 
         void reset_candidates() {
             m_candidates.reset();
+            m_candidate_gen++;
+            if (m_candidate_gen == 0) {
+                // wrap-around: old stamps could alias the new round.
+                m_candidate_stamp.reset();
+            }
+            if (m_candidate_stamp.size() > 4 * 1024)
+                m_candidate_stamp.reset();
         }
 
         enode_vector const & get_candidates() const {
@@ -2309,6 +2329,11 @@ namespace {
 
         if (!m_pc)
             goto backtrack;
+        // Instructions are linked heap objects; the interpreter is latency
+        // bound on the m_pc->m_next chain. Fetch the successor one iteration
+        // ahead so its cache line is in flight while the current instruction
+        // executes.
+        machine_prefetch(m_pc->m_next);
         TRACE(mam_int, display_pc_info(tout););
         
 #ifdef _PROFILE_MAM
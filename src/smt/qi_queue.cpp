@@ -148,6 +148,25 @@ namespace smt {
     }
 
     void qi_queue::instantiate() {
+        // Produce cheap instances first: when the eager budget or the maximum
+        // number of instances is reached, the entries that are cut off are the
+        // expensive ones.
+        std::stable_sort(m_new_entries.begin(), m_new_entries.end(),
+                         [](entry const & e1, entry const & e2) { return e1.m_cost < e2.m_cost; });
+
+        // Adapt the eager threshold to conflict frequency: long conflict-free
+        // stretches of eager instantiation indicate that instances are flooding
+        // the clause database without guiding the search, so successively delay
+        // more of them. The threshold is restored as soon as a conflict occurs
+        // (and at the beginning of each search). Delayed entries are still
+        // processed at final check, so this only postpones work.
+        unsigned num_conflicts = m_context.get_num_conflicts();
+        if (num_conflicts != m_conflicts_at_last_batch) {
+            m_conflicts_at_last_batch = num_conflicts;
+            m_eager_since_conflict    = 0;
+            m_eager_cost_threshold    = m_params.m_qi_eager_threshold;
+        }
+
         unsigned since_last_check = 0;
         for (entry & curr : m_new_entries) {
             if (m_context.get_cancel_flag()) {
@@ -163,6 +182,8 @@ namespace smt {
 
             if (curr.m_cost <= m_eager_cost_threshold) {
                 instantiate(curr);
+                if (++m_eager_since_conflict % 1000 == 0)
+                    m_eager_cost_threshold /= 2.0;
             }
             else if (m_params.m_qi_promote_unsat && m_checker.is_unsat(qa->get_expr(), f->get_num_args(), f->get_args())) {
                 // do not delay instances that produce a conflict.
@@ -399,6 +420,9 @@ namespace smt {
     void qi_queue::init_search_eh() {
         m_subst.reset();
         m_new_entries.reset();
+        m_eager_cost_threshold    = m_params.m_qi_eager_threshold;
+        m_eager_since_conflict    = 0;
+        m_conflicts_at_last_batch = m_context.get_num_conflicts();
     }
 
     bool qi_queue::final_check_eh() {
@@ -53,6 +53,8 @@ namespace smt {
         cached_var_subst              m_subst;
         svector<float>                m_vals;
         double                        m_eager_cost_threshold = 0;
+        unsigned                      m_conflicts_at_last_batch = 0;
+        unsigned                      m_eager_since_conflict = 0;
         std::function<bool(quantifier*,expr*)> m_on_binding;
         struct entry {
             fingerprint * m_qb;
@@ -40,6 +40,37 @@ bool theory_seq::solve_eqs(unsigned i) {
     return change || m_new_propagation || ctx.inconsistent();
 }
 
+bool theory_seq::canonical_form_unchanged(unsigned eq_id, expr_ref_vector const& ls, expr_ref_vector const& rs) {
+    auto same = [](expr_ref_vector const& a, expr_ref_vector const& b) {
+        if (a.size() != b.size())
+            return false;
+        for (unsigned i = 0; i < a.size(); ++i)
+            if (a.get(i) != b.get(i))
+                return false;
+        return true;
+    };
+    eq_form* f = nullptr;
+    return m_eq_forms.find(eq_id, f) && same(ls, f->m_ls) && same(rs, f->m_rs);
+}
+
+void theory_seq::record_canonical_form(unsigned eq_id, expr_ref_vector const& ls, expr_ref_vector const& rs) {
+    eq_form* f = nullptr;
+    if (!m_eq_forms.find(eq_id, f)) {
+        // ids grow monotonically; bound the cache by purging it wholesale.
+        if (m_eq_forms.size() > (1 << 14)) {
+            for (auto const& kv : m_eq_forms)
+                dealloc(kv.m_value);
+            m_eq_forms.reset();
+        }
+        f = alloc(eq_form, m);
+        m_eq_forms.insert(eq_id, f);
+    }
+    f->m_ls.reset();
+    f->m_ls.append(ls);
+    f->m_rs.reset();
+    f->m_rs.append(rs);
+}
+
 bool theory_seq::solve_eq(unsigned idx) {
     const depeq& e = m_eqs[idx];
     expr_ref_vector& ls = m_ls;
@@ -56,9 +87,17 @@ bool theory_seq::solve_eq(unsigned idx) {
           tout << ls << " = " << rs << "\n";
           display_deps(tout, deps););
 
-    if (!ctx.inconsistent() && simplify_eq(ls, rs, deps)) {
-        TRACE(seq, tout << "simplified\n";);
-        return true;
+    // simplify_eq is deterministic in (ls, rs); when the canonical form is
+    // unchanged since the last time simplify_eq made no progress on it
+    // (typically after a backtrack), the rewriter-based simplification is
+    // skipped. The form is recorded only on failed attempts: a successful
+    // simplification may be undone by backtracking and must be replayed.
+    if (!ctx.inconsistent() && !canonical_form_unchanged(e.id(), ls, rs)) {
+        if (simplify_eq(ls, rs, deps)) {
+            TRACE(seq, tout << "simplified\n";);
+            return true;
+        }
+        record_canonical_form(e.id(), ls, rs);
     }
 
     if (!ctx.inconsistent() && lift_ite(ls, rs, deps)) {
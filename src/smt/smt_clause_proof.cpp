@@ -21,7 +21,7 @@ Revision History:
 namespace smt {
     
     clause_proof::clause_proof(context& ctx):
-        ctx(ctx), m(ctx.get_manager()), m_lits(m), m_pp(m),
+        ctx(ctx), m(ctx.get_manager()), m_lits(m), m_trail_refs(m), m_pp(m),
         m_assumption(m), m_rup(m), m_del(m), m_smt(m) {
         
         auto proof_log = ctx.get_fparams().m_proof_log;
@@ -188,10 +188,26 @@ namespace smt {
         m_pp.define_expr(out, e);
     }
 
+    unsigned clause_proof::trail_id(expr* e) {
+        unsigned id = e->get_id();
+        if (!m_trail_id2expr.contains(id)) {
+            m_trail_id2expr.insert(id, e);
+            m_trail_refs.push_back(e);
+        }
+        return id;
+    }
+
     void clause_proof::update(status st, expr_ref_vector& v, proof* p) {
         TRACE(clause_proof, tout << m_trail.size() << " " << st << " " << v << "\n";);
-        if (ctx.get_fparams().m_clause_proof)
-            m_trail.push_back(info(st, v, p));
+        if (ctx.get_fparams().m_clause_proof) {
+            // append a fixed-format record; the expressions are shared with
+            // the rest of the search, only their ids are stored
+            m_trail.push_back(static_cast<unsigned>(st));
+            m_trail.push_back(p ? trail_id(p) : null_hint);
+            m_trail.push_back(v.size());
+            for (expr* e : v)
+                m_trail.push_back(trail_id(e));
+        }
         if (m_on_clause_eh) 
             m_on_clause_eh(m_on_clause_ctx, p, 0, nullptr, v.size(), v.data());
         
@@ -240,15 +256,21 @@ namespace smt {
         TRACE(context, tout << "get-proof " << ctx.get_fparams().m_clause_proof << "\n";);
         if (!ctx.get_fparams().m_clause_proof) 
             return proof_ref(m);
-        expr_ref_vector ps(m);
-        for (auto& info : m_trail) {
-            expr_ref fact = mk_or(info.m_clause);
-            proof* pr = info.m_proof;
+        expr_ref_vector ps(m), lits(m);
+        for (unsigned i = 0; i < m_trail.size(); ) {
+            status st = static_cast<status>(m_trail[i++]);
+            unsigned hint = m_trail[i++];
+            unsigned num_lits = m_trail[i++];
+            lits.reset();
+            for (unsigned j = 0; j < num_lits; ++j)
+                lits.push_back(m_trail_id2expr[m_trail[i++]]);
+            expr_ref fact = mk_or(lits);
+            proof* pr = hint == null_hint ? nullptr : to_app(m_trail_id2expr[hint]);
             expr* args[2] = { pr, fact };
             unsigned num_args = 2, offset = 0;
-            if (!pr) 
+            if (!pr)
                 offset = 1;
-            switch (info.m_status) {
+            switch (st) {
             case status::assumption:
                 ps.push_back(m.mk_app(symbol("assumption"), num_args - offset, args + offset, m.mk_proof_sort()));
                 break;
@@ -31,6 +31,7 @@ Revision History:
 #include "smt/smt_clause.h"
 #include "smt/smt_justification.h"
 #include "tactic/user_propagator_base.h"
+#include "util/map.h"
 
 namespace smt {
     class context;
@@ -47,16 +48,17 @@ namespace smt {
         };
     private:
 
-        struct info {
-            status          m_status;
-            expr_ref_vector m_clause;     
-            proof_ref       m_proof;
-            info(status st, expr_ref_vector& v, proof* p): m_status(st), m_clause(v), m_proof(p, m_clause.m()) {}
-        };
+        static const unsigned null_hint = UINT_MAX;
+
         context&        ctx;
         ast_manager&    m;
         expr_ref_vector m_lits;
-        vector<info>    m_trail;
+        // Flat trail of fixed-format records [status, hint-id, #lits, lit-ids...].
+        // Referenced expressions are pinned once in m_trail_refs and indexed by
+        // id; the proof object is only materialized on demand in get_proof.
+        svector<unsigned> m_trail;
+        expr_ref_vector   m_trail_refs;
+        u_map<expr*>      m_trail_id2expr;
         bool            m_enabled = false;
         bool            m_has_log = false;
         user_propagator::on_clause_eh_t m_on_clause_eh;
@@ -66,7 +68,8 @@ namespace smt {
         proof_ref m_assumption, m_rup, m_del, m_smt;
 
         void init_pp_out();
-        
+
+        unsigned trail_id(expr* e);
         void update(status st, expr_ref_vector& v, proof* p);
         void update(clause& c, status st, proof* p, literal_buffer const* simp_lits);
         status kind2st(clause_kind k);
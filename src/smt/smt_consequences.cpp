@@ -93,6 +93,17 @@ namespace smt {
         if (found) {
             fml = m.mk_implies(antecedent2fml(s), fml);
             conseq.push_back(fml);
+            if (!assumptions.contains(lit.var())) {
+                // Learn the clause (~antecedents or lit) so that later rounds
+                // obtain the fixed literal by unit propagation at the search level
+                // instead of re-deriving it through conflict resolution.
+                literal_vector literals;
+                for (unsigned v : s) {
+                    literals.push_back(literal(v, get_assignment(v) == l_true));
+                }
+                literals.push_back(lit);
+                mk_clause(literals.size(), literals.data(), nullptr);
+            }
         }
     }
 
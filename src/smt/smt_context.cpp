@@ -18,6 +18,7 @@ Revision History:
 --*/
 #include<math.h>
 #include "util/luby.h"
+#include "util/machine.h"
 #include "util/warning.h"
 #include "util/timeit.h"
 #include "util/union_find.h"
@@ -1702,6 +1703,7 @@ namespace smt {
      */
     bool context::propagate() {
         TRACE(propagate, tout << "propagating... " << m_qhead << ":" << m_assigned_literals.size() << "\n");
+        phase_profiler::scope _ps(m_phase_profiler, phase_profiler::PROPAGATE);
         
         while (true) {
             if (inconsistent())
@@ -1966,7 +1968,20 @@ namespace smt {
        \brief Execute generic undo-objects.
     */
     void context::undo_trail_stack(unsigned old_size) {
-        ::undo_trail_stack(m_trail_stack, old_size);
+        // Deep backjumps undo tens of thousands of trail objects. Their memory
+        // is reclaimed wholesale by m_region in pop_scope_core, but the undo
+        // actions themselves are semantic and have to run one by one; the walk
+        // is latency bound on dereferencing each region-allocated object for
+        // its virtual undo, so fetch objects a few entries ahead.
+        SASSERT(old_size <= m_trail_stack.size());
+        unsigned i = m_trail_stack.size();
+        while (i != old_size) {
+            --i;
+            if (i >= old_size + 4)
+                machine_prefetch(m_trail_stack[i - 4]);
+            m_trail_stack[i]->undo();
+        }
+        m_trail_stack.shrink(old_size);
     }
 
     /**
@@ -2732,7 +2747,8 @@ namespace smt {
     inline void context::del_inactive_lemmas() {
         if (m_fparams.m_lemma_gc_strategy == LGC_NONE)
             return;
-        else if (m_fparams.m_lemma_gc_half)
+        phase_profiler::scope _ps(m_phase_profiler, phase_profiler::GC);
+        if (m_fparams.m_lemma_gc_half)
             del_inactive_lemmas1();
         else
             del_inactive_lemmas2();
@@ -3212,6 +3228,7 @@ namespace smt {
     void context::reduce_assertions() {
         if (!m_asserted_formulas.inconsistent()) {
             // SASSERT(at_base_level());
+            phase_profiler::scope _ps(m_phase_profiler, phase_profiler::SIMPLIFY);
             m_asserted_formulas.reduce();
         }
     }
@@ -3257,6 +3274,7 @@ namespace smt {
         if (get_cancel_flag()) return;
         if (m_internalizing_assertions) return;
         flet<bool> _internalizing(m_internalizing_assertions, true);
+        phase_profiler::scope _ps(m_phase_profiler, phase_profiler::INTERNALIZE);
         TRACE(internalize_assertions, tout << "internalize_assertions()...\n";);
         timeit tt(get_verbosity_level() >= 100, "smt.preprocessing");
         unsigned qhead = 0;
@@ -3512,6 +3530,7 @@ namespace smt {
               );
         m_search_finalized = true;
         display_profile(verbose_stream());
+        IF_VERBOSE(10, m_phase_profiler.display(verbose_stream()));
         if (r == l_true && get_cancel_flag()) 
             r = l_undef;
         if (r == l_undef && m_internal_completed == l_true && has_sls_model()) {
@@ -3985,6 +4004,16 @@ namespace smt {
                     (m_fparams.m_lemma_gc_strategy == LGC_FIXED || m_fparams.m_lemma_gc_strategy == LGC_GEOMETRIC)) {
                     del_inactive_lemmas();
                 }
+                else if (memory::above_soft_limit() && m_num_conflicts_since_lemma_gc > m_fparams.m_recent_lemmas_size) {
+                    // approaching the memory budget: shed half of the learned
+                    // lemmas regardless of the configured gc strategy. This is
+                    // a safe point (no conflict being resolved), and a slower
+                    // answer beats hitting the hard limit below.
+                    IF_VERBOSE(10, verbose_stream() << "(smt.mem-pressure-gc)\n";);
+                    phase_profiler::scope _ps(m_phase_profiler, phase_profiler::GC);
+                    del_inactive_lemmas1();
+                    m_num_conflicts_since_lemma_gc = 0;
+                }
 
                 m_dyn_ack_manager.propagate_eh();
                 CASSERT("dyn_ack", check_clauses(m_lemmas) && check_clauses(m_aux_clauses));
@@ -4053,6 +4082,7 @@ namespace smt {
     }
 
     final_check_status context::final_check() {
+        phase_profiler::scope _ps(m_phase_profiler, phase_profiler::FINAL_CHECK);
         TRACE(final_check, tout << "final_check inconsistent: " << inconsistent() << "\n"; display(tout); display_normalized_enodes(tout););
         CASSERT("relevancy", check_relevancy());
         
@@ -4102,6 +4132,13 @@ namespace smt {
             m_final_check_idx = (m_final_check_idx + 1) % range;
             // IF_VERBOSE(1000, verbose_stream() << "final check status: " << ok << "\n";);
 
+            if (inconsistent()) {
+                // A final check left the context inconsistent: resolve the
+                // conflict immediately instead of running the remaining
+                // (possibly expensive) final checks on a doomed state.
+                return FC_CONTINUE;
+            }
+
             switch (ok) {
             case FC_DONE:
                 break;
@@ -44,6 +44,7 @@ Revision History:
 #include "util/ref.h"
 #include "util/timer.h"
 #include "util/statistics.h"
+#include "util/phase_profiler.h"
 #include "smt/fingerprints.h"
 #include "smt/proto_model/proto_model.h"
 #include "smt/theory_user_propagator.h"
@@ -86,6 +87,18 @@ namespace smt {
     public:
         statistics                  m_stats;
 
+        /**
+           \brief Per-theory clause footprint: number of axioms/lemmas a theory
+           added to the clause database and their literal volume, indexed by
+           theory id. Reported through collect_statistics so the producer of
+           clause database growth can be identified from solver statistics.
+        */
+        struct th_clause_stats {
+            unsigned m_num_axioms = 0;
+            unsigned m_num_lemmas = 0;
+            unsigned m_num_lits = 0;
+        };
+
         std::ostream& display_last_failure(std::ostream& out) const;
         std::string last_failure_as_string() const;
         void set_reason_unknown(char const* msg) { m_unknown = msg; }
@@ -97,6 +110,8 @@ namespace smt {
         smt_params &                m_fparams;
         params_ref                  m_params;
         ::statistics                m_aux_stats;
+        phase_profiler              m_phase_profiler;
+        svector<th_clause_stats>    m_th_clause_stats;
         setup                       m_setup;
         unsigned                    m_relevancy_lvl;
         timer                       m_timer;
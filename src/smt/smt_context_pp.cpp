@@ -423,10 +423,22 @@ namespace smt {
         st.update("minimized lits", m_stats.m_num_minimized_lits);
         st.update("num checks", m_stats.m_num_checks);
         st.update("mk bool var", m_stats.m_num_mk_bool_var ? m_stats.m_num_mk_bool_var - 1 : 0);
+        m_phase_profiler.collect_statistics(st);
         m_qmanager->collect_statistics(st);
         m_asserted_formulas.collect_statistics(st);
         for (theory* th : m_theory_set) {
             th->collect_statistics(st);
+            theory_id tid = th->get_id();
+            if (static_cast<unsigned>(tid) >= m_th_clause_stats.size())
+                continue;
+            th_clause_stats const & s = m_th_clause_stats[tid];
+            if (s.m_num_axioms == 0 && s.m_num_lemmas == 0)
+                continue;
+            // statistics does not copy keys, so intern them as symbols.
+            std::string name = th->get_name();
+            st.update(symbol((name + " clause axioms").c_str()).bare_str(), s.m_num_axioms);
+            st.update(symbol((name + " clause lemmas").c_str()).bare_str(), s.m_num_lemmas);
+            st.update(symbol((name + " clause literals").c_str()).bare_str(), s.m_num_lits);
         }
     }
 
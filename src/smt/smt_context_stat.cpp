@@ -144,5 +144,7 @@ namespace smt {
     void context::display_profile(std::ostream & out) const {
         if (m_fparams.m_profile_res_sub)
             display_profile_res_sub(out);
+        if (m_fparams.m_qi_profile)
+            m_qmanager->display(out);
     }
 };
@@ -1564,6 +1564,17 @@ namespace smt {
         justification * js = nullptr;
         TRACE(mk_th_axiom, display_literals_verbose(tout, num_lits, lits) << "\n";);
 
+        if (tid != null_theory_id) {
+            if (static_cast<unsigned>(tid) >= m_th_clause_stats.size())
+                m_th_clause_stats.resize(tid + 1);
+            th_clause_stats & s = m_th_clause_stats[tid];
+            if (k == CLS_TH_AXIOM)
+                s.m_num_axioms++;
+            else
+                s.m_num_lemmas++;
+            s.m_num_lits += num_lits;
+        }
+
         if (m.proofs_enabled()) {
             js = mk_justification(theory_axiom_justification(tid, *this, num_lits, lits, num_params, params));
         }
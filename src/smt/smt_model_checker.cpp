@@ -342,8 +342,84 @@ namespace smt {
        \brief Return true if q is satisfied by m_curr_model.
     */
 
+    /**
+       \brief Try to decide whether q is satisfied by m_curr_model by evaluating
+       its body on every tuple over the universes of its bound sorts. This
+       avoids the auxiliary context when all bound sorts are finite in the
+       current model and the number of tuples is small, which is the common
+       shape for quantifiers over uninterpreted sorts. Returns l_undef when a
+       tuple does not evaluate to a definite truth value; the caller then falls
+       back to the auxiliary solver.
+    */
+    lbool model_checker::check_by_evaluation(quantifier * q) {
+        unsigned num_decls  = q->get_num_decls();
+        unsigned max_tuples = 1024;
+        unsigned num_tuples = 1;
+        vector<ptr_vector<expr>> universes;
+        for (unsigned i = 0; i < num_decls; i++) {
+            sort * s = q->get_decl_sort(i);
+            if (!m_curr_model->is_finite(s))
+                return l_undef;
+            obj_hashtable<expr> const & u = m_curr_model->get_known_universe(s);
+            if (u.empty() || u.size() > max_tuples / num_tuples)
+                return l_undef;
+            num_tuples *= u.size();
+            universes.push_back(ptr_vector<expr>());
+            for (expr * e : u)
+                universes.back().push_back(e);
+        }
+        var_subst subst(m);
+        expr_ref_vector args(m), bindings(m);
+        args.resize(num_decls);
+        unsigned num_cexs = 0;
+        for (unsigned t = 0; t < num_tuples; t++) {
+            unsigned idx = t;
+            for (unsigned i = 0; i < num_decls; i++) {
+                unsigned sz = universes[i].size();
+                args[i] = universes[i][idx % sz];
+                idx /= sz;
+            }
+            expr_ref inst = subst(q->get_expr(), num_decls, args.data());
+            expr_ref val(m);
+            if (!m_curr_model->eval(inst, val, true))
+                return l_undef;
+            if (m.is_true(val))
+                continue;
+            if (!m.is_false(val))
+                return l_undef;
+            // map universe values back to terms of the main context,
+            // following the conventions of add_instance for cex models.
+            bindings.reset();
+            bindings.resize(num_decls);
+            for (unsigned i = 0; i < num_decls; i++) {
+                expr * b = args.get(i);
+                expr * t2 = get_term_from_ctx(b);
+                if (t2 != nullptr)
+                    b = t2;
+                if (contains_model_value(b))
+                    b = get_type_compatible_term(b);
+                bindings.set(i, b);
+            }
+            TRACE(model_checker, tout << q->get_qid() << " evaluation cex: " << bindings << "\n";);
+            add_instance(q, bindings, m_qm->get_generation(q), nullptr);
+            num_cexs++;
+            if (num_cexs >= m_max_cexs)
+                return l_false;
+        }
+        if (num_cexs > 0)
+            return l_false;
+        return is_safe_for_mbqi(q) ? l_true : l_undef;
+    }
+
     bool model_checker::check(quantifier * q) {
         SASSERT(!m_aux_context->relevancy());
+
+        switch (check_by_evaluation(q)) {
+        case l_true:  return true;  // all tuples satisfied
+        case l_false: return false; // counterexample instances were added
+        default: break;
+        }
+
         scoped_ctx_push _push(m_aux_context.get());
 
         quantifier * flat_q = get_flat_quantifier(q);
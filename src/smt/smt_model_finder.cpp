@@ -559,6 +559,9 @@ namespace smt {
 
            
             void cleanup_instantiation_sets() {
+                // The model is not modified during this pass, so evaluations are
+                // shared across the instantiation sets: the sets of different
+                // nodes typically contain many common ground terms.
                 for (node* curr : m_nodes) {
                     if (curr->is_root()) {
                         instantiation_set* s = curr->get_instantiation_set();
@@ -572,11 +575,11 @@ namespace smt {
                                 to_delete.push_back(n);
                             }
                         }
-                        for (expr* e : to_delete) 
+                        for (expr* e : to_delete)
                             s->remove(e);
-                        reset_eval_cache();
                     }
                 }
+                reset_eval_cache();
             }
 
             void display_nodes(std::ostream& out) const {
@@ -46,6 +46,10 @@ namespace smt {
         flet<unsigned> _nt(ctx.m_fparams.m_threads, 1);
         unsigned thread_max_conflicts = ctx.get_fparams().m_threads_max_conflicts;
         unsigned max_conflicts = ctx.get_fparams().m_max_conflicts;
+        // In deterministic mode threads run to their per-round budget without
+        // cancelling each other, and the winner is resolved by thread index
+        // after the round, so repeated runs produce the same answer.
+        bool deterministic = ctx.get_fparams().m_threads_deterministic;
 
         // try first sequential with a low conflict budget to make super easy problems cheap
         unsigned max_c = std::min(thread_max_conflicts, 40u);
@@ -105,6 +109,9 @@ namespace smt {
             }
         };
 
+        svector<lbool> thread_results(num_threads, l_undef);
+        bool_vector    thread_finished(num_threads, false);
+
         obj_hashtable<expr> unit_set;
         expr_ref_vector unit_trail(ctx.m);
         unsigned_vector unit_lim;
@@ -173,7 +180,14 @@ namespace smt {
                     pctx.assert_expr(mk_not(mk_and(pctx.unsat_core())));
                     return;
                 } 
-                
+
+                if (deterministic) {
+                    // record the outcome and let the round run to completion;
+                    // the winner is selected by index once all threads joined.
+                    thread_results[i] = r;
+                    thread_finished[i] = true;
+                    return;
+                }
 
                 bool first = false;
                 {
@@ -229,6 +243,18 @@ namespace smt {
             for (auto & th : threads) {
                 th.join();
             }
+            if (deterministic) {
+                for (unsigned i = 0; i < num_threads; ++i) {
+                    if (!thread_finished[i]) 
+                        continue;
+                    done = true;
+                    // prefer the lowest-index definite answer over giving up
+                    if (finished_id == UINT_MAX || (result == l_undef && thread_results[i] != l_undef)) {
+                        finished_id = i;
+                        result = thread_results[i];
+                    }
+                }
+            }
             if (done) break;
 
             collect_units();
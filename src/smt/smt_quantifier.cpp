@@ -196,6 +196,22 @@ namespace smt {
             m_quantifier_stat.erase(q);
         }
 
+        void display_profile(std::ostream & out) {
+            for (quantifier * q : m_quantifiers)
+                display_stats(out, q);
+        }
+
+        void collect_statistics(::statistics & st) const {
+            for (quantifier * q : m_quantifiers) {
+                unsigned n = get_stat(q)->get_num_instances();
+                if (n == 0)
+                    continue;
+                // statistics does not copy keys, so intern them as symbols.
+                std::string name = "quantifier instances " + q->get_qid().str();
+                st.update(symbol(name.c_str()).bare_str(), n);
+            }
+        }
+
         bool empty() const {
             return m_quantifiers.empty();
         }
@@ -565,10 +581,12 @@ namespace smt {
     }
 
     void quantifier_manager::display(std::ostream & out) const {
+        m_imp->display_profile(out);
     }
 
     void quantifier_manager::collect_statistics(::statistics & st) const {
         m_imp->m_qi_queue.collect_statistics(st);
+        m_imp->collect_statistics(st);
     }
 
     void quantifier_manager::reset_statistics() {
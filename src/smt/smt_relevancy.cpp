@@ -141,6 +141,13 @@ namespace smt {
         typedef list<relevancy_eh *>   relevancy_ehs;
         obj_map<expr, relevancy_ehs *> m_relevant_ehs;
         obj_map<expr, relevancy_ehs *> m_watches[2];
+        // Bitmaps indexed by expression id recording whether a handler/watch was
+        // ever registered. The common case (AND/OR/ITE without watchers) then
+        // skips the hash table lookups on every mark and assignment. The bits are
+        // conservative: they are not cleared on backtracking, a stale bit only
+        // costs the old lookup.
+        uint_set                       m_has_handlers;
+        uint_set                       m_has_watches[2];
         struct eh_trail {
             enum class kind { POS_WATCH, NEG_WATCH, HANDLER };
             kind   m_kind;
@@ -212,6 +219,7 @@ namespace smt {
             else {
                 SASSERT(eh);
                 push_trail(eh_trail(source));
+                m_has_handlers.insert(source->get_id());
                 set_handlers(source, new (get_region()) relevancy_ehs(eh, get_handlers(source)));
             }
         }
@@ -227,6 +235,7 @@ namespace smt {
                 return;
             case l_undef:
                 SASSERT(eh);
+                m_has_watches[val ? 1 : 0].insert(n->get_id());
                 set_watches(n, val, new (get_region()) relevancy_ehs(eh, get_watches(n, val)));
                 push_trail(eh_trail(n, val));
                 break;
@@ -528,10 +537,12 @@ namespace smt {
                     }
                 }
                 
-                relevancy_ehs * ehs = get_handlers(n);
-                while (ehs != nullptr) {
-                    ehs->head()->operator()(*this, n);
-                    ehs = ehs->tail();
+                if (m_has_handlers.contains(n->get_id())) {
+                    relevancy_ehs * ehs = get_handlers(n);
+                    while (ehs != nullptr) {
+                        ehs->head()->operator()(*this, n);
+                        ehs = ehs->tail();
+                    }
                 }
             }
         }
@@ -553,10 +564,12 @@ namespace smt {
                 else if (m.is_implies(n))
                     propagate_relevant_implies(to_app(n));
             }
-            relevancy_ehs * ehs = get_watches(n, val);
-            while (ehs != nullptr) {
-                ehs->head()->operator()(*this, n, val);
-                ehs = ehs->tail();
+            if (m_has_watches[val ? 1 : 0].contains(n->get_id())) {
+                relevancy_ehs * ehs = get_watches(n, val);
+                while (ehs != nullptr) {
+                    ehs->head()->operator()(*this, n, val);
+                    ehs = ehs->tail();
+                }
             }
         }
 
@@ -123,10 +123,32 @@ namespace smt {
     bool theory_array::instantiate_axiom2b_for(theory_var v) {
         bool result = false;
         var_data * d = m_var_data[v];
-        for (enode* n1 : d->m_parent_stores) 
-            for (enode * n2 : d->m_parent_selects) 
-                if (instantiate_axiom2b(n2, n1))
+        if (m_params.m_array_cg) {
+            // cgr status of a node changes over time; do the full rescan.
+            for (enode* n1 : d->m_parent_stores)
+                for (enode * n2 : d->m_parent_selects)
+                    if (instantiate_axiom2b(n2, n1))
+                        result = true;
+            return result;
+        }
+        unsigned num_stores  = d->m_parent_stores.size();
+        unsigned num_selects = d->m_parent_selects.size();
+        if (num_stores == d->m_axiom2b_stores && num_selects == d->m_axiom2b_selects)
+            return false;
+        // enumerate only pairs involving a new store or a new select;
+        // old pairs were either queued (fingerprinted) or skipped for a
+        // reason that a pop undoes together with the counters below.
+        for (unsigned i = 0; i < num_stores; ++i) {
+            enode * n1 = d->m_parent_stores[i];
+            unsigned j = i < d->m_axiom2b_stores ? d->m_axiom2b_selects : 0;
+            for (; j < num_selects; ++j)
+                if (instantiate_axiom2b(d->m_parent_selects[j], n1))
                     result = true;
+        }
+        m_trail_stack.push(value_trail<unsigned>(d->m_axiom2b_stores));
+        m_trail_stack.push(value_trail<unsigned>(d->m_axiom2b_selects));
+        d->m_axiom2b_stores  = num_stores;
+        d->m_axiom2b_selects = num_selects;
         return result;
     }
 
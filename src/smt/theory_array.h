@@ -42,6 +42,13 @@ namespace smt {
             ptr_vector<enode>  m_stores;
             ptr_vector<enode>  m_parent_selects;
             ptr_vector<enode>  m_parent_stores;
+            // access index for axiom 2b: prefixes of m_parent_stores and
+            // m_parent_selects whose pairs were already enumerated. Re-visits
+            // only consider pairs involving a new store or select. The
+            // counters are trailed, so backtracking re-opens pairs whose
+            // instantiation (or skip) was undone by a pop.
+            unsigned           m_axiom2b_stores = 0;
+            unsigned           m_axiom2b_selects = 0;
             bool               m_prop_upward = false;
             bool               m_is_array = false;
             bool               m_is_select = false;
@@ -66,14 +66,32 @@ namespace smt {
         bool result = false;
         var_data * d = m_var_data[v];
         var_data_full * d_full = m_var_data_full[v];
-        for (unsigned i = 0; i < d_full->m_parent_maps.size(); ++i) {
+        if (m_params.m_array_cg) {
+            // cgr status of a node changes over time; do the full rescan.
+            for (enode* pm : d_full->m_parent_maps)
+                for (enode* ps : d->m_parent_selects)
+                    if (instantiate_select_map_axiom(ps, pm))
+                        result = true;
+            return result;
+        }
+        unsigned num_maps    = d_full->m_parent_maps.size();
+        unsigned num_selects = d->m_parent_selects.size();
+        if (num_maps == d_full->m_map_axiom_maps && num_selects == d_full->m_map_axiom_selects)
+            return false;
+        // enumerate only pairs involving a new map or a new select; old
+        // pairs are fingerprinted and the fingerprints are popped together
+        // with the counters below.
+        for (unsigned i = 0; i < num_maps; ++i) {
             enode* pm = d_full->m_parent_maps[i];
-            for (unsigned j = 0; j < d->m_parent_selects.size(); ++j) {
-                enode* ps = d->m_parent_selects[j];
-                if (instantiate_select_map_axiom(ps, pm)) 
-                    result = true;                  
-            }  
-        }
+            unsigned j = i < d_full->m_map_axiom_maps ? d_full->m_map_axiom_selects : 0;
+            for (; j < num_selects; ++j)
+                if (instantiate_select_map_axiom(d->m_parent_selects[j], pm))
+                    result = true;
+        }
+        m_trail_stack.push(value_trail<unsigned>(d_full->m_map_axiom_maps));
+        m_trail_stack.push(value_trail<unsigned>(d_full->m_map_axiom_selects));
+        d_full->m_map_axiom_maps    = num_maps;
+        d_full->m_map_axiom_selects = num_selects;
         return result;
     }
 
@@ -30,6 +30,9 @@ namespace smt {
             ptr_vector<enode>  m_as_arrays;
             ptr_vector<enode>  m_lambdas;
             ptr_vector<enode>  m_parent_maps;
+            // access index for the map axiom, see var_data::m_axiom2b_stores.
+            unsigned           m_map_axiom_maps = 0;
+            unsigned           m_map_axiom_selects = 0;
         };
 
         ptr_vector<var_data_full> m_var_data_full;
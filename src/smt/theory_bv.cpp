@@ -1154,6 +1154,64 @@ namespace smt {
               " relevant1: " << ctx.is_relevant(get_enode(v1)) << 
               " relevant2: " << ctx.is_relevant(get_enode(v2)) << "\n";);
         m_find.merge(v1, v2);
+        slice_eq(v1, v2);
+    }
+
+    /**
+       \brief Slice an equality between two concatenations into equalities
+       over the aligned parts. The core then merges the sub-terms at word
+       granularity, so congruence closure resolves wide datapath equalities
+       without consulting the individual bit assignments. Misaligned
+       segments are left to bit-level propagation.
+    */
+    void theory_bv::slice_eq(theory_var v1, theory_var v2) {
+        if (v1 > v2)
+            std::swap(v1, v2);
+        enode * n1 = get_enode(v1);
+        enode * n2 = get_enode(v2);
+        expr * e1 = n1->get_expr();
+        expr * e2 = n2->get_expr();
+        if (!m_util.is_concat(e1) || !m_util.is_concat(e2))
+            return;
+        if (!ctx.add_fingerprint(n1, n1->get_owner_id(), 1, &n2))
+            return;
+        app * c1 = to_app(e1);
+        app * c2 = to_app(e2);
+        // walk both concatenations from the least significant end and
+        // emit an equality for every segment whose cut points coincide
+        // and that consists of a single argument on each side.
+        unsigned i = c1->get_num_args(), j = c2->get_num_args();
+        unsigned off1 = 0, off2 = 0;
+        literal eq = null_literal;
+        while (i > 0 && j > 0) {
+            expr * a1 = c1->get_arg(i - 1); // least significant bits are last
+            expr * a2 = c2->get_arg(j - 1);
+            unsigned sz1 = m_util.get_bv_size(a1);
+            unsigned sz2 = m_util.get_bv_size(a2);
+            if (off1 + sz1 == off2 + sz2) {
+                if (off1 == off2 && a1 != a2) {
+                    if (eq == null_literal) {
+                        eq = mk_eq(e1, e2, true);
+                        ctx.mark_as_relevant(eq);
+                    }
+                    literal sub_eq = mk_eq(a1, a2, true);
+                    ctx.mark_as_relevant(sub_eq);
+                    ctx.mk_th_axiom(get_id(), ~eq, sub_eq);
+                }
+                off1 += sz1;
+                off2 += sz2;
+                --i;
+                --j;
+            }
+            else if (off1 + sz1 < off2 + sz2) {
+                off1 += sz1;
+                --i;
+            }
+            else {
+                off2 += sz2;
+                --j;
+            }
+        }
     }
 
     void theory_bv::new_diseq_eh(theory_var v1, theory_var v2) {
@@ -238,6 +238,7 @@ namespace smt {
         bool internalize_term(app * term) override;
         void apply_sort_cnstr(enode * n, sort * s) override;
         void new_eq_eh(theory_var v1, theory_var v2) override;
+        void slice_eq(theory_var v1, theory_var v2);
         void new_diseq_eh(theory_var v1, theory_var v2) override;
         virtual void expand_diseq(theory_var v1, theory_var v2);
         void assign_eh(bool_var v, bool is_true) override;
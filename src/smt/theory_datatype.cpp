@@ -480,15 +480,23 @@ namespace smt {
         force_push();
         int num_vars = get_num_vars();
         final_check_status r = FC_DONE;
-        final_check_st _guard(this); 
+        final_check_st _guard(this);
+        // The acyclicity sweep depends only on the egraph: merges add edges
+        // between classes and new enodes add constructor occurrences. Both
+        // context counters are monotone and pops only remove edges, which
+        // cannot create a cycle, so when the egraph is unchanged since the
+        // last clean sweep the traversals are skipped wholesale.
+        unsigned num_eqs    = ctx.m_stats.m_num_add_eq;
+        unsigned num_enodes = ctx.m_stats.m_num_mk_enode;
+        bool egraph_changed = m_oc_num_eqs != num_eqs || m_oc_num_enodes != num_enodes;
         for (int v = 0; v < num_vars; v++) {
             if (v == static_cast<int>(m_find.find(v))) {
                 enode * node = get_enode(v);
                 sort* s = node->get_sort();
                 if (!m_util.is_datatype(s))
                     continue;
-                if (m_util.is_recursive(s) && !oc_cycle_free(node) && occurs_check(node)) {
-                    // conflict was detected... 
+                if (egraph_changed && m_util.is_recursive(s) && !oc_cycle_free(node) && occurs_check(node)) {
+                    // conflict was detected...
                     // return...
                     return FC_CONTINUE;
                 }
@@ -503,6 +511,11 @@ namespace smt {
                 }
             }
         }
+        // all classes passed the sweep; record the egraph timestamps taken
+        // before the sweep (splits above may have created new enodes, which
+        // then force a re-check on the next call).
+        m_oc_num_eqs    = num_eqs;
+        m_oc_num_enodes = num_enodes;
         return r;
     }
 
@@ -743,6 +756,8 @@ namespace smt {
         theory::reset_eh();
         m_util.reset();
         m_stats.reset();
+        m_oc_num_eqs    = UINT_MAX;
+        m_oc_num_enodes = UINT_MAX;
     }
 
     bool theory_datatype::is_shared(theory_var v) const {
@@ -83,6 +83,12 @@ namespace smt {
         svector<stack_entry>  m_stack; // stack for DFS for occurs_check
         literal_vector        m_lits;
 
+        // egraph timestamps (context add_eq/mk_enode counters) at the last
+        // occurs-check sweep that found no cycle; the sweep is skipped while
+        // they are unchanged. UINT_MAX forces the initial sweep.
+        unsigned              m_oc_num_eqs = UINT_MAX;
+        unsigned              m_oc_num_enodes = UINT_MAX;
+
         void clear_mark();
 
         void oc_mark_on_stack(enode * n);
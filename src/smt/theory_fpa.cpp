@@ -196,6 +196,9 @@ namespace smt {
 
     expr_ref theory_fpa::mk_side_conditions()
     {
+        // conversions that hit the rewriter cache produce no new side conditions
+        if (m_converter.m_extra_assertions.empty())
+            return expr_ref(m.mk_true(), m);
 
         expr_ref res(m), t(m);
         expr_ref_vector fmls(m);
@@ -135,6 +135,22 @@ class theory_lra::imp {
     typedef vector<std::pair<rational, lpvar>> var_coeffs;
 
     var_coeffs               m_left_side;              // constraint left side
+
+    // Hash-consing of linearized definitions: syntactically distinct terms
+    // frequently linearize to the same left side. The first definition owns
+    // the term column; later occurrences are defined as two-entry alias rows
+    // over it, so the tableau does not accumulate duplicate rows.
+    struct var_coeffs_hash {
+        unsigned operator()(var_coeffs const& vc) const {
+            unsigned h = 17;
+            for (auto const& [c, v] : vc)
+                h = combine_hash(combine_hash(h, c.hash()), v);
+            return h;
+        }
+    };
+    map<var_coeffs, lpvar, var_coeffs_hash, default_eq<var_coeffs>> m_left_side2term;
+    vector<var_coeffs>       m_left_side_trail;
+    var_coeffs               m_left_side_sorted;
     lpvar m_one_var;
     lpvar m_zero_var;
     lpvar m_rone_var;
@@ -707,6 +723,36 @@ class theory_lra::imp {
         }
     };
 
+    struct undo_term_key : public trail {
+        imp& s;
+        undo_term_key(imp& s):s(s) {}
+        void undo() override {
+            s.m_left_side2term.erase(s.m_left_side_trail.back());
+            s.m_left_side_trail.pop_back();
+        }
+    };
+
+    // Look up the coefficient-sorted left side among previously defined terms.
+    // On a hit the new definition becomes an alias row v = w over the shared
+    // column; otherwise the term is added and registered for reuse.
+    lpvar add_or_share_term(theory_var v) {
+        m_left_side_sorted = m_left_side;
+        std::sort(m_left_side_sorted.begin(), m_left_side_sorted.end(),
+                  [](auto const& p1, auto const& p2) { return p1.second < p2.second; });
+        lpvar wi = lp::null_lpvar;
+        if (m_left_side2term.find(m_left_side_sorted, wi)) {
+            ++m_stats.m_shared_terms;
+            var_coeffs alias;
+            alias.push_back({rational::one(), wi});
+            return lp().add_term(alias, v);
+        }
+        lpvar vi = lp().add_term(m_left_side, v);
+        m_left_side2term.insert(m_left_side_sorted, vi);
+        m_left_side_trail.push_back(m_left_side_sorted);
+        ctx().push_trail(undo_term_key(*this));
+        return vi;
+    }
+
     void register_fixed_var(theory_var v, rational const& value) {
         if (m_value2var.contains(value)) 
             return;
@@ -806,7 +852,7 @@ class theory_lra::imp {
                 add_def_constraint_and_equality(vi, lp::LE, rational(0));
             }
             else {
-                vi = lp().add_term(m_left_side, v);
+                vi = add_or_share_term(v);
                 SASSERT(lp().column_has_term(vi));
                 TRACE(arith_verbose, 
                       tout << "v" << v << " := " << mk_pp(term, m) 
@@ -260,6 +260,7 @@ theory_seq::theory_seq(context& ctx):
     m_factory(nullptr),
     m_exclude(m),
     m_axioms(m),
+    m_base_axioms(m),
     m_axioms_head(0),
     m_int_string(m),
     m_ubv_string(m),
@@ -290,6 +291,8 @@ theory_seq::theory_seq(context& ctx):
 
 theory_seq::~theory_seq() {
     m_trail_stack.reset();
+    for (auto const& kv : m_eq_forms)
+        dealloc(kv.m_value);
 }
 
 void theory_seq::init() {
@@ -2690,6 +2693,12 @@ void theory_seq::propagate() {
         expr_ref e(m);
         e = m_axioms.get(m_axioms_head);
         deque_axiom(e);
+        // axioms expanded at base level produce permanent clauses;
+        // remember them so they are not re-derived after a restart.
+        if (ctx.at_base_level() && !ctx.inconsistent() && !m_base_axiom_set.contains(e)) {
+            m_base_axioms.push_back(e);
+            m_base_axiom_set.insert(e);
+        }
         ++m_axioms_head;
     }
     while (!m_replay.empty() && !ctx.inconsistent()) {
@@ -2705,6 +2714,8 @@ void theory_seq::propagate() {
 }
 
 void theory_seq::enque_axiom(expr* e) {
+    if (m_base_axiom_set.contains(e))
+        return;
     if (!m_axiom_set.contains(e)) {
         TRACE(seq, tout << "add axiom " << mk_bounded_pp(e, m) << "\n";);
         m_axioms.push_back(e);
@@ -171,6 +171,16 @@ namespace smt {
             return depeq(m_eq_id++, ls, rs, dep);
         }        
 
+        // Last canonical form of an equation, keyed by equation id.
+        // The cache deliberately survives backtracking: equation ids are
+        // never reused and simplification is deterministic in the canonical
+        // form, so a form that was already simplified to a fixed-point need
+        // not be re-simplified after a pop.
+        struct eq_form {
+            expr_ref_vector m_ls, m_rs;
+            eq_form(ast_manager& m): m_ls(m), m_rs(m) {}
+        };
+
         // equalities that are decomposed by conacatenations
         typedef std::pair<expr_ref_vector, expr_ref_vector> decomposed_eq;
 
@@ -341,6 +351,8 @@ namespace smt {
         exclusion_table            m_exclude;    // set of asserted disequalities.
         expr_ref_vector            m_axioms;     // list of axioms to add.
         obj_hashtable<expr>        m_axiom_set;
+        expr_ref_vector            m_base_axioms;   // axioms expanded at base level; pinned, never popped.
+        obj_hashtable<expr>        m_base_axiom_set;
         unsigned                   m_axioms_head; // index of first axiom to add.
         bool                       m_incomplete;             // is the solver (clearly) incomplete for the fragment.
         expr_ref_vector            m_int_string;
@@ -460,6 +472,9 @@ namespace smt {
         dependency* m_eq_deps { nullptr };
         bool solve_eqs(unsigned start);
         bool solve_eq(unsigned idx);
+        u_map<eq_form*> m_eq_forms;
+        bool canonical_form_unchanged(unsigned eq_id, expr_ref_vector const& ls, expr_ref_vector const& rs);
+        void record_canonical_form(unsigned eq_id, expr_ref_vector const& ls, expr_ref_vector const& rs);
         bool simplify_eq(expr_ref_vector& l, expr_ref_vector& r, dependency* dep);
         bool lift_ite(expr_ref_vector const& l, expr_ref_vector const& r, dependency* dep);
         obj_pair_hashtable<expr, expr> m_nth_eq2_cache;
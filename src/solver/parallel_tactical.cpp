@@ -137,6 +137,11 @@ class parallel_tactic : public tactic {
             return m_tasks.empty() && m_num_waiters > 0;
         }
 
+        unsigned num_waiters() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_num_waiters;
+        }
+
         solver_state* get_task() { 
             while (!m_shutdown) {
                 inc_wait();
@@ -528,9 +533,23 @@ private:
         cube.append(s.split_cubes(1));
         SASSERT(cube.size() <= 1);
         IF_VERBOSE(2, verbose_stream() << "(tactic.parallel :split-cube " << cube.size() << ")\n";);
-        {
-            // std::lock_guard<std::mutex> lock(m_mutex);
-            if (!s.cubes().empty()) m_queue.add_task(s.clone());
+        if (!s.cubes().empty()) {
+            // Hand the remaining cubes back as several tasks when other threads
+            // are idle, so they obtain work immediately and a hard cube being
+            // conquered by this thread does not pin the rest of the set.
+            unsigned num_tasks = std::min(s.cubes().size(), 1 + m_queue.num_waiters());
+            vector<cube_var> rest = s.split_cubes(s.cubes().size());
+            unsigned chunk = (rest.size() + num_tasks - 1) / num_tasks;
+            vector<cube_var> share;
+            for (unsigned i = 0; i < rest.size(); ) {
+                share.reset();
+                for (unsigned j = 0; j < chunk && i < rest.size(); ++j, ++i)
+                    share.push_back(rest[i]);
+                s.set_cubes(share);
+                m_queue.add_task(s.clone());
+            }
+            share.reset();
+            s.set_cubes(share);
         }
         if (!cube.empty()) {
             s.assert_cube(cube.get(0).cube());
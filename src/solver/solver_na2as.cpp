@@ -25,7 +25,8 @@ Notes:
 
 solver_na2as::solver_na2as(ast_manager & m):
     solver(m), 
-    m_assumptions(m) {
+    m_assumptions(m),
+    m_retracted_trail(m) {
 }
 
 void solver_na2as::assert_expr_core2(expr * t, expr * a) {
@@ -59,21 +60,50 @@ struct append_assumptions {
     }
 };
 
+void solver_na2as::retract_assertion(expr * a) {
+    SASSERT(is_uninterp_const(a));
+    SASSERT(m.is_bool(a));
+    if (m_retracted.contains(a))
+        return;
+    TRACE(solver_na2as, tout << "retracting\n" << mk_ismt2_pp(a, m) << "\n";);
+    m_retracted.insert(a);
+    m_retracted_trail.push_back(a);
+    assert_expr_core(m.mk_not(a));
+}
+
+void solver_na2as::active_assumptions(expr_ref_vector & out) const {
+    for (expr * a : m_assumptions)
+        if (!m_retracted.contains(a))
+            out.push_back(a);
+}
+
 lbool solver_na2as::check_sat_core(unsigned num_assumptions, expr * const * assumptions) {
     append_assumptions app(m_assumptions, num_assumptions, assumptions);
     TRACE(solver_na2as, display(tout););
-    return check_sat_core2(m_assumptions.size(), m_assumptions.data());
+    if (m_retracted.empty())
+        return check_sat_core2(m_assumptions.size(), m_assumptions.data());
+    expr_ref_vector active(m);
+    active_assumptions(active);
+    return check_sat_core2(active.size(), active.data());
 }
 
 lbool solver_na2as::check_sat_cc(const expr_ref_vector &assumptions, vector<expr_ref_vector> const &clauses) {
     if (clauses.empty()) return check_sat(assumptions.size(), assumptions.data());
     append_assumptions app(m_assumptions, assumptions.size(), assumptions.data());
-    return check_sat_cc_core(m_assumptions, clauses);
+    if (m_retracted.empty())
+        return check_sat_cc_core(m_assumptions, clauses);
+    expr_ref_vector active(m);
+    active_assumptions(active);
+    return check_sat_cc_core(active, clauses);
 }
 
 lbool solver_na2as::get_consequences(expr_ref_vector const& asms, expr_ref_vector const& vars, expr_ref_vector& consequences) {
     append_assumptions app(m_assumptions, asms.size(), asms.data());
-    return get_consequences_core(m_assumptions, vars, consequences);
+    if (m_retracted.empty())
+        return get_consequences_core(m_assumptions, vars, consequences);
+    expr_ref_vector active(m);
+    active_assumptions(active);
+    return get_consequences_core(active, vars, consequences);
 }
 
 lbool solver_na2as::find_mutexes(expr_ref_vector const& vars, vector<expr_ref_vector>& mutexes) {
@@ -85,6 +115,7 @@ void solver_na2as::push() {
     unsigned n = m_assumptions.size();
     push_core();
     m_scopes.push_back(n);
+    m_retracted_lim.push_back(m_retracted_trail.size());
 }
 
 void solver_na2as::pop(unsigned n) {
@@ -95,6 +126,11 @@ void solver_na2as::pop(unsigned n) {
         unsigned new_lvl = lvl - n;
         restore_assumptions(m_scopes[new_lvl]);
         m_scopes.shrink(new_lvl);
+        unsigned old_sz = m_retracted_lim[new_lvl];
+        for (unsigned i = m_retracted_trail.size(); i-- > old_sz; )
+            m_retracted.remove(m_retracted_trail.get(i));
+        m_retracted_trail.shrink(old_sz);
+        m_retracted_lim.shrink(new_lvl);
     }
 }
 
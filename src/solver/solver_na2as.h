@@ -25,14 +25,29 @@ Notes:
 
 class solver_na2as : public solver {
  protected:
-    expr_ref_vector    m_assumptions;
-    unsigned_vector    m_scopes;
+    expr_ref_vector     m_assumptions;
+    obj_hashtable<expr> m_retracted;       // disabled named assertions
+    expr_ref_vector     m_retracted_trail;
+    unsigned_vector     m_retracted_lim;
+    unsigned_vector     m_scopes;
     void restore_assumptions(unsigned old_sz);
+    void active_assumptions(expr_ref_vector & out) const;
 public:
     solver_na2as(ast_manager & m);
 
     void assert_expr_core2(expr * t, expr * a) override;
 
+    /**
+       \brief Disable the named assertion tracked by literal \c a without
+       popping the solver: the literal is dropped from the assumptions passed
+       to check_sat and its negation is asserted, so the underlying solver can
+       discard clauses guarded by it. This keeps all other internalized
+       assertions intact, which is much cheaper than pop-to-base plus
+       re-assertion when only a few of many assertions change between checks.
+       Retractions performed inside a scope are undone by pop.
+    */
+    void retract_assertion(expr * a);
+
     // Subclasses of solver_na2as should redefine the following *_core methods instead of these ones.
     lbool check_sat_core(unsigned num_assumptions, expr * const * assumptions) override;
     lbool check_sat_cc(const expr_ref_vector &assumptions, vector<expr_ref_vector> const &clauses) override;
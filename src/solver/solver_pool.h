@@ -16,11 +16,22 @@ Author:
 
 Notes:
 
-    This is a revision of spacer_virtual_solver 
+    This is a revision of spacer_virtual_solver
     consolidated with spacer_smt_context_manager
     by Arie Gurfinkel
     Use this module as a replacement for spacer_smt_context_manager.
 
+    Learned-state sharing: the pool hands out virtual solvers that
+    multiplex a small number of base solvers through guard predicates.
+    All virtual solvers rotating over the same base therefore share its
+    learned clauses and theory lemmas implicitly -- an acquire is warm,
+    not cold; retiring a virtual solver only asserts the negation of its
+    guard. Explicit lemma transfer between the base solvers themselves is
+    not done: learned clauses live inside the underlying solver and
+    routinely mention guard predicates and auxiliary variables that have
+    no meaning in another base, and the solver interface deliberately
+    does not expose them.
+
 --*/
 #pragma once
 
@@ -317,6 +317,17 @@ struct ctx_simplify_tactic::imp {
             r = cell.m_result->m_to;
             return true;
         }
+        // Entries surviving in the cell were established under an active
+        // prefix of the current assumptions, so they remain valid here.
+        // Deeper scopes could in principle simplify further, which is why
+        // hits normally require an exact level match -- but a value is
+        // already maximally simplified, so such hits lose no precision.
+        if (cell.m_result != nullptr && m.is_value(cell.m_result->m_to)) {
+            SASSERT(cell.m_from == t);
+            SASSERT(cell.m_result->m_lvl <= scope_level());
+            r = cell.m_result->m_to;
+            return true;
+        }
         return false;
     }
 
@@ -533,6 +544,9 @@ struct ctx_simplify_tactic::imp {
         }
         pop(scope_level() - old_lvl);
 
+        // recount occurrences on the rewritten goal; without the reset the
+        // stale counts double up and every surviving term tests as shared
+        m_occs.reset();
         m_occs(g);
 
         // go backwards
@@ -94,85 +94,32 @@ class reduce_args_tactic : public tactic {
         tactic::checkpoint(m);
     }
     
-    struct find_non_candidates_proc {
-        ast_manager &              m;
-        bv_util &                  m_bv;
-        array_util &               m_ar;
-        obj_hashtable<func_decl> & m_non_candidates;
-        
-        find_non_candidates_proc(ast_manager & m, bv_util & bv, array_util& ar, obj_hashtable<func_decl> & non_candidates):
-            m(m),
-            m_bv(bv),
-            m_ar(ar),
-            m_non_candidates(non_candidates) {
-        }
-        
-        void operator()(var * n) {}
-        
-        void operator()(quantifier *n) {}
-        
-        void operator()(app * n) {
-            func_decl * d;
-            if (m_ar.is_as_array(n, d)) {
-                m_non_candidates.insert(d);
-                return;
-            }
-            if (n->get_num_args() == 0)
-                return; // ignore constants
-            d = n->get_decl();
-            if (d->get_family_id() != null_family_id)
-                return; // ignore interpreted symbols
-            if (m_non_candidates.contains(d))
-                return; // it is already in the set.
-            unsigned j    = n->get_num_args();        
-            while (j > 0) {
-                --j;
-                if (may_be_unique(m, m_bv, n->get_arg(j)))
-                    return;
-            }  
-            m_non_candidates.insert(d);
-        }
-    };
-
-    /**
-       \brief Populate the table non_candidates with function declarations \c f
-       such that there is a function application (f t1 ... tn) where t1 ... tn are not values.
-    */
-    void find_non_candidates(goal const & g, obj_hashtable<func_decl> & non_candidates) {
-        non_candidates.reset();
-        for (expr* v : m_vars)
-            if (is_app(v))
-                non_candidates.insert(to_app(v)->get_decl());
-        find_non_candidates_proc proc(m, m_bv, m_ar, non_candidates);
-        expr_fast_mark1 visited;
-        unsigned sz = g.size();
-        for (unsigned i = 0; i < sz; i++) {
-            checkpoint();
-            quick_for_each_expr(proc, visited, g.form(i));
-        }
-        
-        TRACE(reduce_args, tout << "non_candidates:\n";
-                for (func_decl* d : non_candidates)
-                    tout << d->get_name() << "\n";
-              );
-    }
-
     struct populate_decl2args_proc {
         ast_manager &                     m;
         bv_util &                         m_bv;
+        array_util &                      m_ar;
         obj_hashtable<func_decl> &        m_non_candidates;
-        obj_map<func_decl, bit_vector> &  m_decl2args;    
+        obj_map<func_decl, bit_vector> &  m_decl2args;
         obj_map<func_decl, svector<expr*> > m_decl2base; // for args = base + offset
 
-        populate_decl2args_proc(ast_manager & m, bv_util & bv, obj_hashtable<func_decl> & nc, obj_map<func_decl, bit_vector> & d):
-            m(m), m_bv(bv), m_non_candidates(nc), m_decl2args(d) {}
-        
+        populate_decl2args_proc(ast_manager & m, bv_util & bv, array_util & ar, obj_hashtable<func_decl> & nc, obj_map<func_decl, bit_vector> & d):
+            m(m), m_bv(bv), m_ar(ar), m_non_candidates(nc), m_decl2args(d) {}
+
         void operator()(var * n) {}
         void operator()(quantifier * n) {}
         void operator()(app * n) {
+            func_decl * d;
+            if (m_ar.is_as_array(n, d)) {
+                // the function escapes as a first-class value; its
+                // applications cannot be renamed
+                m_non_candidates.insert(d);
+                m_decl2args.erase(d);
+                m_decl2base.erase(d);
+                return;
+            }
             if (n->get_num_args() == 0)
                 return; // ignore constants
-            func_decl * d = n->get_decl();
+            d = n->get_decl();
             if (d->get_family_id() != null_family_id)
                 return; // ignore interpreted symbols
             if (m_non_candidates.contains(d))
@@ -203,19 +150,26 @@ class reduce_args_tactic : public tactic {
         }
     };
 
-    void populate_decl2args(goal const & g, 
-                            obj_hashtable<func_decl> & non_candidates, 
+    void populate_decl2args(goal const & g,
+                            obj_hashtable<func_decl> & non_candidates,
                             obj_map<func_decl, bit_vector> & decl2args) {
         expr_fast_mark1 visited;
         decl2args.reset();
-        populate_decl2args_proc proc(m, m_bv, non_candidates, decl2args);
+        non_candidates.reset();
+        for (expr* v : m_vars)
+            if (is_app(v))
+                non_candidates.insert(to_app(v)->get_decl());
+        populate_decl2args_proc proc(m, m_bv, m_ar, non_candidates, decl2args);
         unsigned sz = g.size();
         for (unsigned i = 0; i < sz; i++) {
             checkpoint();
             quick_for_each_expr(proc, visited, g.form(i));
         }
-        
+
         // Remove all cases where the simplification is not applicable.
+        // An application whose arguments are all non-unique zeroes every bit
+        // of its declaration, so this also covers what a separate
+        // non-candidate prefilter pass would find.
         ptr_buffer<func_decl> bad_decls;
         for (auto const& [k, v] : decl2args) {
             bool is_zero = true;
@@ -416,7 +370,6 @@ class reduce_args_tactic : public tactic {
         tactic_report report("reduce-args", g);
         obj_hashtable<func_decl> non_candidates;
         obj_map<func_decl, bit_vector> decl2args;
-        find_non_candidates(g, non_candidates);
         populate_decl2args(g, non_candidates, decl2args);
         
         if (decl2args.empty())
@@ -176,9 +176,9 @@ private:
         unsigned num_occs = 0;
         compute_sort_colors(fml, coloring);
         compute_max_depth(fml, depth);
-        merge_colors(occs, coloring);        
-        merge_colors(depth, coloring);     
-        // compute_siblings(fml, coloring);
+        merge_colors(occs, coloring);
+        merge_colors(depth, coloring);
+        compute_siblings(fml, coloring);
         compute_inv_app(coloring, inv_color);
         
         for (auto const& [k, v] : inv_color) {
@@ -340,57 +340,39 @@ private:
     void compute_parents(expr* e, app_map& parents) {
     }
 
-    typedef hashtable<unsigned, u_hash, u_eq> uint_set;
-    typedef obj_map<app, uint_set*> app_siblings;;
-
     class siblings {
         app_map const& m_colors;
-        app_siblings m_sibs;
+        app_map&       m_colors1;
     public:
-        siblings(app_map const& colors): m_colors(colors) {}
+        siblings(app_map const& colors, app_map& colors1): m_colors(colors), m_colors1(colors1) {}
 
-        app_siblings const& get() { return m_sibs; }
         void operator()(app* n) {
             unsigned sz = n->get_num_args();
-            for (unsigned i = 0; i < sz; ++i) {
-                expr* e = n->get_arg(i);
-                if (!is_app(e)) continue;
-                auto& value = m_sibs.insert_if_not_there(to_app(e), 0);
-                if (!value) value = alloc(uint_set);
-                for (unsigned j = 0; j < sz; ++j) {
-                    expr* f = n->get_arg(j);
-                    if (is_app(f) && i != j) {
-                        unsigned c1 = 0;
-                        m_colors.find(to_app(f), c1);
-                        value->insert(c1);
-                    }
-                }
-            }
+            if (sz < 2)
+                return;
+            unsigned sum = 0, c = 0;
+            for (expr* e : *n)
+                if (is_app(e) && m_colors.find(to_app(e), c))
+                    sum += 1 + c;
+            for (expr* e : *n)
+                if (is_app(e) && m_colors.find(to_app(e), c))
+                    m_colors1.insert_if_not_there(to_app(e), 0) += sum - (1 + c);
         }
         void operator()(quantifier *n) {}
-        void operator()(var* n) {}        
+        void operator()(var* n) {}
     };
     // refine coloring by taking colors of siblings into account.
+    // each argument is tagged with the sum of its sibling colors accumulated
+    // over all parents; the sum is invariant under term automorphisms and
+    // costs linear time per parent.
     bool compute_siblings_rec(expr* e, app_map& colors) {
-        siblings sibs(colors);
         app_map colors1;
+        siblings sibs(colors, colors1);
         for_each_expr(sibs, e);
-        app_siblings const& s = sibs.get();
-        app_siblings::iterator it = s.begin(), end = s.end();
-        for (; it != end; ++it) {
-            app* a = it->m_key;
-            uint_set* set = it->m_value;
-            uint_set::iterator it2 = set->begin(), end2 = set->end();
-            unsigned c = 0;
-            for(; it2 != end2; ++it2) {
-                c += 1 + *it2;
-            }
-            colors1.insert(a, c);
-            dealloc(set);
-        }
-        if (is_app(e)) {
-            colors1.insert(to_app(e), 0);
-        }
+        // terms that never occur in a sibling position (the root, arguments
+        // of unary applications, quantifier bodies) carry no constraint.
+        for (auto const& kv : colors)
+            colors1.insert_if_not_there(kv.m_key, 0);
         return merge_colors(colors1, colors);
     }
     void compute_siblings(expr* fml, app_map& colors) {
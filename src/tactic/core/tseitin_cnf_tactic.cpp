@@ -278,9 +278,39 @@ class tseitin_cnf_tactic : public tactic {
             return false;
         }
         
+        /**
+           \brief Return true if ls is a short clause of distinct,
+           non-complementary, non-constant literals. For such clauses the
+           disjunction can be built directly, without the simplification
+           (and its marking machinery) performed by the rewriter.
+        */
+        bool is_simple_clause(unsigned num, expr * const * ls) {
+            if (num > 8)
+                return false;
+            for (unsigned i = 0; i < num; i++) {
+                expr * a = ls[i];
+                m.is_not(a, a);
+                if (m.is_true(a) || m.is_false(a))
+                    return false;
+                for (unsigned j = 0; j < i; j++) {
+                    expr * b = ls[j];
+                    m.is_not(b, b);
+                    if (a == b)
+                        return false; // duplicate or complementary pair
+                }
+            }
+            return true;
+        }
+
         void mk_clause(unsigned num, expr * const * ls) {
             expr_ref cls(m);
-            m_rw.mk_or(num, ls, cls);
+            // the Tseitin templates mostly emit small clauses of distinct
+            // literals; the rewriter pass is only needed when literals
+            // repeat, cancel or are constants.
+            if (is_simple_clause(num, ls))
+                cls = (num == 1) ? ls[0] : m.mk_or(num, ls);
+            else
+                m_rw.mk_or(num, ls, cls);
             m_clauses.push_back(cls);
             if (m_produce_unsat_cores)
                 m_deps.push_back(m_curr_dep);
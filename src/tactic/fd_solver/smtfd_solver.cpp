@@ -1602,6 +1602,7 @@ namespace smtfd {
         unsigned_vector m_toggles_lim;
         model_ref       m_model;
         std::string     m_reason_unknown;
+        bool            m_batch_refine = false;
 
         void set_delay_simplify() {
             params_ref p;
@@ -1973,7 +1974,19 @@ namespace smtfd {
                 expr_ref_vector terms(core);
                 terms.append(m_axioms);
 
-                if (!m_context.add_theory_axioms(terms, round)) {
+                if (m_batch_refine) {
+                    // pipelined mode: exhaust the plugin rounds on the
+                    // current candidate model and refute it with a single
+                    // solver call, instead of alternating between one
+                    // plugin round and one solver call per model
+                    while (!m_context.at_max() && m_context.add_theory_axioms(terms, round)) {
+                        ++round;
+                    }
+                    if (m_context.empty()) {
+                        break;
+                    }
+                }
+                else if (!m_context.add_theory_axioms(terms, round)) {
                     break;
                 }
                 if (m_context.empty()) {
@@ -2023,13 +2036,15 @@ namespace smtfd {
                 m_fd_core_solver->updt_params(p);  
             }
             m_context.set_max_lemmas(UINT_MAX); // p.get_uint("max-lemmas", 100));
-        }        
+            m_batch_refine = p.get_bool("refine-batch", m_batch_refine);
+        }
 
-        void collect_param_descrs(param_descrs & r) override { 
+        void collect_param_descrs(param_descrs & r) override {
             init();
-            m_fd_sat_solver->collect_param_descrs(r); 
+            m_fd_sat_solver->collect_param_descrs(r);
             r.insert("max-lemmas", CPK_UINT, "maximal number of lemmas per round", "10");
-        }    
+            r.insert("refine-batch", CPK_BOOL, "batch all theory refinement rounds for a candidate model into a single solver call", "false");
+        }
 
         void set_produce_models(bool f) override { }
         void set_progress_callback(progress_callback * callback) override { }
@@ -100,6 +100,7 @@ void goal::copy_to(goal & target) const {
     if (this == &target)
         return;
 
+    target.invalidate_fingerprint();
     m().copy(m_forms, target.m_forms);
     m().copy(m_proofs, target.m_proofs);
     m().copy(m_dependencies, target.m_dependencies);
@@ -118,6 +119,7 @@ void goal::push_back(expr * f, proof * pr, expr_dependency * d) {
     SASSERT(!proofs_enabled() || pr);
     if (m().is_true(f))
         return;
+    invalidate_fingerprint();
     if (m().is_false(f)) {
         // Make sure pr and d are not deleted by the m().del(...) statements.
         proof_ref saved_pr(m());
@@ -284,6 +286,7 @@ void goal::get_formulas(expr_ref_vector & result) const {
 void goal::update(unsigned i, expr * f, proof * pr, expr_dependency * d) {
     if (m_inconsistent)
         return;
+    invalidate_fingerprint();
     if (proofs_enabled()) {
         SASSERT(pr);
         if (!pr)
@@ -322,6 +325,7 @@ void goal::update(unsigned i, expr * f, proof * pr, expr_dependency * d) {
 }
 
 void goal::reset_core() {
+    invalidate_fingerprint();
     m().del(m_forms);
     m().del(m_proofs);
     m().del(m_dependencies);
@@ -462,17 +466,55 @@ void goal::display_dimacs(std::ostream & out, bool include_names) const {
 }
 
 unsigned goal::num_exprs() const {
-    expr_fast_mark1 visited;
-    unsigned sz = size();
-    unsigned r  = 0;
-    for (unsigned i = 0; i < sz; i++) {
-        r += get_num_exprs(form(i), visited);
+    return get_fingerprint().m_num_exprs;
+}
+
+goal::fingerprint const & goal::get_fingerprint() const {
+    if (!m_fingerprint_valid) {
+        struct proc {
+            ast_manager & m;
+            fingerprint & fp;
+            family_id     m_arith_fid;
+            family_id     m_bv_fid;
+            proc(ast_manager & m, fingerprint & fp):
+                m(m),
+                fp(fp),
+                m_arith_fid(m.mk_family_id("arith")),
+                m_bv_fid(m.mk_family_id("bv")) {}
+            void operator()(quantifier *) { fp.m_num_exprs++; }
+            void operator()(var *) { fp.m_num_exprs++; }
+            void operator()(app * n) {
+                fp.m_num_exprs++;
+                if (n->get_num_args() == 0 && !m.is_value(n)) {
+                    if (m.is_bool(n)) {
+                        fp.m_num_bool_consts++;
+                    }
+                    else {
+                        fp.m_num_consts++;
+                        family_id fid = n->get_sort()->get_family_id();
+                        if (fid == m_arith_fid)
+                            fp.m_num_arith_consts++;
+                        else if (fid == m_bv_fid)
+                            fp.m_num_bv_consts++;
+                    }
+                }
+            }
+        };
+        m_fingerprint = fingerprint();
+        proc p(m(), m_fingerprint);
+        expr_fast_mark1 visited;
+        unsigned sz = size();
+        for (unsigned i = 0; i < sz; i++) {
+            for_each_expr_core<proc, expr_fast_mark1, true, true>(p, visited, form(i));
+        }
+        m_fingerprint_valid = true;
     }
-    return r;
+    return m_fingerprint;
 }
 
 void goal::shrink(unsigned j) {
     SASSERT(j <= size());
+    invalidate_fingerprint();
     unsigned sz = size();
     for (unsigned i = j; i < sz; i++)
         m().pop_back(m_forms);
@@ -64,9 +64,10 @@ protected:
     unsigned              m_models_enabled:1;  // model generation is enabled.
     unsigned              m_proofs_enabled:1;  // proof production is enabled. m_manager.proofs_enabled() must be true if m_proofs_enabled == true
     unsigned              m_core_enabled:1;    // unsat core extraction is enabled.
-    unsigned              m_inconsistent:1;    // true if the goal is known to be inconsistent. 
+    unsigned              m_inconsistent:1;    // true if the goal is known to be inconsistent.
     unsigned              m_precision:2;       // PRECISE, UNDER, OVER.
 
+    void invalidate_fingerprint() { m_fingerprint_valid = false; }
     void push_back(expr * f, proof * pr, expr_dependency * d);
     void quick_process(bool save_first, expr_ref & f, expr_dependency * d);
     void process_and(bool save_first, app * f, proof * pr, expr_dependency * d, expr_ref & out_f, proof_ref & out_pr);
@@ -119,6 +120,29 @@ public:
     unsigned size() const { return m().size(m_forms); }
 
     unsigned num_exprs() const;
+
+    /**
+       \brief Cheap goal fingerprint: the counters consulted by the standard
+       probes (num-exprs, num-consts, num-bool-consts, num-arith-consts,
+       num-bv-consts). It is computed lazily in a single traversal and
+       invalidated whenever the set of assertions changes, so tacticals that
+       stack several probes over the same goal pay for at most one traversal.
+    */
+    struct fingerprint {
+        unsigned m_num_exprs = 0;
+        unsigned m_num_consts = 0;        // non-Boolean constants
+        unsigned m_num_bool_consts = 0;
+        unsigned m_num_arith_consts = 0;
+        unsigned m_num_bv_consts = 0;
+    };
+
+    fingerprint const & get_fingerprint() const;
+
+private:
+    mutable fingerprint   m_fingerprint;
+    mutable bool          m_fingerprint_valid = false;
+
+public:
   
     expr * form(unsigned i) const { return inconsistent() ? m().mk_false() : m().get(m_forms, i); }
     proof * pr(unsigned i) const { return m().size(m_proofs) > i ? static_cast<proof*>(m().get(m_proofs, i)) : nullptr; }
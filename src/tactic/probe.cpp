@@ -443,6 +443,15 @@ public:
         m_bool(b), m_family(f) {
     }
     result operator()(goal const & g) override {
+        // the goal fingerprint covers the standard cases in O(1).
+        if (m_bool)
+            return result(g.get_fingerprint().m_num_bool_consts);
+        if (m_family == nullptr)
+            return result(g.get_fingerprint().m_num_consts);
+        if (strcmp(m_family, "arith") == 0)
+            return result(g.get_fingerprint().m_num_arith_consts);
+        if (strcmp(m_family, "bv") == 0)
+            return result(g.get_fingerprint().m_num_bv_consts);
         proc p(g.m(), m_bool, m_family);
         unsigned sz = g.size();
         expr_fast_mark1 visited;
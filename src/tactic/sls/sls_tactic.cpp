@@ -222,9 +222,37 @@ public:
 
 };
 
+static tactic * mk_sls_walker(ast_manager & m, params_ref const & p) {
+    return clean(alloc(sls_tactic, m, p));
+}
+
+static tactic * mk_sls_smt_walker(ast_manager & m, params_ref const & p) {
+    return alloc(sls_smt_tactic, m, p);
+}
+
+// Run sls.threads many walkers in parallel. par translates the goal into a
+// fresh ast_manager per walker, so walkers share no state; they are
+// diversified by random seed and restart initialization, and the first
+// walker to finish wins.
+static tactic * mk_sls_walkers(ast_manager & m, params_ref const & p, tactic * (*mk_walker)(ast_manager &, params_ref const &)) {
+    sls_params sp(p);
+    unsigned num_threads = sp.threads();
+    if (num_threads <= 1)
+        return mk_walker(m, p);
+    ptr_vector<tactic> ts;
+    for (unsigned i = 0; i < num_threads; ++i) {
+        params_ref wp = p;
+        wp.set_uint("random_seed", sp.random_seed() + i);
+        if (i > 0)
+            wp.set_bool("restart_init", true);
+        ts.push_back(mk_walker(m, wp));
+    }
+    return par(ts.size(), ts.data());
+}
+
 static tactic * mk_sls_tactic(ast_manager & m, params_ref const & p) {
     return and_then(fail_if_not(mk_is_qfbv_probe()), // Currently only QF_BV is supported.
-                    clean(alloc(sls_tactic, m, p)));
+                    mk_sls_walkers(m, p, mk_sls_walker));
 }
 
 static tactic * mk_preamble(ast_manager & m, params_ref const & p, bool add_nnf) {
@@ -265,7 +293,7 @@ tactic * mk_qfbv_sls_tactic(ast_manager & m, params_ref const & p) {
 
 
 tactic* mk_sls_smt_tactic(ast_manager& m, params_ref const& p) {
-    tactic* t = and_then(mk_preamble(m, p, false), alloc(sls_smt_tactic, m, p));
+    tactic* t = and_then(mk_preamble(m, p, false), mk_sls_walkers(m, p, mk_sls_smt_walker));
     t->updt_params(p);
     return t;
 }
@@ -19,6 +19,7 @@ Notes:
 #include "util/scoped_timer.h"
 #include "util/cancel_eh.h"
 #include "util/scoped_ptr_vector.h"
+#include "ast/for_each_ast.h"
 #include "tactic/tactical.h"
 #include "tactic/goal_proof_converter.h"
 #ifndef SINGLE_THREAD
@@ -1285,3 +1286,274 @@ tactic * skip_if_failed(tactic * t) {
     return or_else(t, mk_skip_tactic());
 }
 
+// Split the goal into connected components that share no uninterpreted
+// symbols, apply t to every component, and recombine the results.
+// Components are conjunctively independent: the goal is satisfiable iff
+// every component is. A single unsatisfiable component therefore refutes
+// the whole goal, and models are merged by stacking the component model
+// converters, which update disjoint sets of declarations.
+class par_components_tactical : public unary_tactical {
+
+    static unsigned find(unsigned_vector & uf, unsigned i) {
+        while (uf[i] != i) {
+            uf[i] = uf[uf[i]];
+            i = uf[i];
+        }
+        return i;
+    }
+
+    // union-find over assertion indices: assertions that share an
+    // uninterpreted symbol end up in the same component.
+    static void compute_components(goal const & g, unsigned_vector & uf) {
+        struct visit {
+            obj_map<func_decl, unsigned> & m_owner;
+            unsigned_vector &              m_uf;
+            unsigned                       m_i = 0;
+            visit(obj_map<func_decl, unsigned> & owner, unsigned_vector & uf):
+                m_owner(owner), m_uf(uf) {}
+            void operator()(func_decl * f) {
+                if (!is_uninterp(f))
+                    return;
+                unsigned owner = m_owner.insert_if_not_there(f, m_i);
+                m_uf[find(m_uf, owner)] = find(m_uf, m_i);
+            }
+            void operator()(ast *) {}
+        };
+        unsigned sz = g.size();
+        uf.reset();
+        for (unsigned i = 0; i < sz; i++)
+            uf.push_back(i);
+        obj_map<func_decl, unsigned> owner;
+        visit visitor(owner, uf);
+        ast_mark mark;
+        for (unsigned i = 0; i < sz; i++) {
+            // the mark must not persist across assertions: shared
+            // sub-terms are exactly what connects two assertions.
+            mark.reset();
+            visitor.m_i = i;
+            for_each_ast(visitor, mark, g.form(i));
+        }
+    }
+
+    // Merge the per-batch results back into a single goal.
+    // Returns false if some batch was shown to be unsat.
+    bool merge_results(goal_ref const & in, goal_ref_vector const & batch_goals,
+                       scoped_ptr_vector<goal_ref_buffer> const & results,
+                       goal_ref_buffer & result) {
+        ast_manager & m = in->m();
+        for (unsigned b = 0; b < results.size(); b++) {
+            goal_ref_buffer * r = results[b];
+            if (r && is_decided_unsat(*r)) {
+                expr_dependency_ref core(m);
+                core = (*r)[0]->dep(0);
+                in->reset();
+                in->assert_expr(m.mk_false(), nullptr, core);
+                result.push_back(in.get());
+                return false;
+            }
+        }
+        in->reset();
+        for (unsigned b = 0; b < results.size(); b++) {
+            goal_ref_buffer const & r = *results[b];
+            if (is_decided_sat(r)) {
+                if (r[0]->mc())
+                    in->add(r[0]->mc());
+                in->updt_prec(r[0]->prec());
+            }
+            else if (r.size() == 1) {
+                goal * g = r[0];
+                for (unsigned j = 0; j < g->size(); j++)
+                    in->assert_expr(g->form(j), g->dep(j));
+                if (g->mc())
+                    in->add(g->mc());
+                if (g->dc())
+                    in->add(g->dc());
+                in->updt_prec(g->prec());
+            }
+            else {
+                // the sub-tactic branched; conjoining formulas across
+                // branches is unsound, so keep the component's original
+                // assertions and discard the partial work.
+                goal * g = batch_goals[b];
+                for (unsigned j = 0; j < g->size(); j++)
+                    in->assert_expr(g->form(j), g->dep(j));
+            }
+        }
+        result.push_back(in.get());
+        return true;
+    }
+
+public:
+    par_components_tactical(tactic * t):unary_tactical(t) {}
+
+    char const* name() const override { return "par_components"; }
+
+    void operator()(goal_ref const & in, goal_ref_buffer& result) override {
+        // merging component proofs back is not supported.
+        fail_if_proof_generation("par_components", in);
+        m_clean = false;
+
+        ast_manager & m = in->m();
+        unsigned sz = in->size();
+        if (sz <= 1) {
+            m_t->operator()(in, result);
+            return;
+        }
+
+        unsigned_vector uf;
+        compute_components(*in, uf);
+
+        // number the components and fold them round-robin into at most
+        // one batch per hardware thread.
+        unsigned_vector root2comp(sz, UINT_MAX);
+        unsigned num_comps = 0;
+        for (unsigned i = 0; i < sz; i++) {
+            unsigned r = find(uf, i);
+            if (root2comp[r] == UINT_MAX)
+                root2comp[r] = num_comps++;
+        }
+        if (num_comps <= 1) {
+            m_t->operator()(in, result);
+            return;
+        }
+        unsigned num_batches = num_comps;
+#ifndef SINGLE_THREAD
+        unsigned hw = std::thread::hardware_concurrency();
+        if (hw > 0 && hw < num_batches)
+            num_batches = hw;
+#endif
+
+        goal_ref_vector batch_goals;
+        for (unsigned b = 0; b < num_batches; b++)
+            batch_goals.push_back(alloc(goal, *in, true));
+        for (unsigned i = 0; i < sz; i++) {
+            unsigned b = root2comp[find(uf, i)] % num_batches;
+            batch_goals[b]->assert_expr(in->form(i), in->dep(i));
+        }
+
+        scoped_ptr_vector<goal_ref_buffer> results;
+        results.resize(num_batches);
+
+#ifdef SINGLE_THREAD
+        for (unsigned b = 0; b < num_batches; b++) {
+            goal_ref_buffer * r = alloc(goal_ref_buffer);
+            results.set(b, r);
+            goal_ref gb = batch_goals[b];
+            m_t->operator()(gb, *r);
+            if (is_decided_unsat(*r))
+                break;
+        }
+        for (unsigned b = 0; b < num_batches; b++) {
+            if (!results[b])
+                results.set(b, alloc(goal_ref_buffer));
+        }
+#else
+        scoped_ptr_vector<ast_manager> managers;
+        tactic_ref_vector              ts;
+        goal_ref_vector                g_copies;
+        for (unsigned b = 0; b < num_batches; b++) {
+            ast_manager * new_m = alloc(ast_manager, m, !m.proof_mode());
+            managers.push_back(new_m);
+            ast_translation translator(m, *new_m);
+            g_copies.push_back(batch_goals[b]->translate(translator));
+            ts.push_back(m_t->translate(*new_m));
+        }
+
+        scoped_ptr_vector<goal_ref_buffer> batch_results;
+        batch_results.resize(num_batches);
+
+        bool found_unsat = false;
+        bool failed = false;
+        par_exception_kind ex_kind = DEFAULT_EX;
+        unsigned error_code = 0;
+        std::string ex_msg;
+        std::mutex mux;
+
+        auto worker_thread = [&](unsigned b) {
+            goal_ref new_g = g_copies[b];
+            goal_ref_buffer * r = alloc(goal_ref_buffer);
+            batch_results.set(b, r);
+            bool curr_failed = false;
+            try {
+                ts[b]->operator()(new_g, *r);
+            }
+            catch (tactic_exception & ex) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (!failed && !found_unsat) {
+                    curr_failed = true;
+                    failed  = true;
+                    ex_kind = TACTIC_EX;
+                    ex_msg  = ex.what();
+                }
+            }
+            catch (z3_error & err) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (!failed && !found_unsat) {
+                    curr_failed = true;
+                    failed     = true;
+                    ex_kind    = ERROR_EX;
+                    error_code = err.error_code();
+                }
+            }
+            catch (z3_exception & z3_ex) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (!failed && !found_unsat) {
+                    curr_failed = true;
+                    failed  = true;
+                    ex_kind = DEFAULT_EX;
+                    ex_msg  = z3_ex.what();
+                }
+            }
+            if (is_decided_unsat(*r)) {
+                // an unsat component refutes the whole goal.
+                std::lock_guard<std::mutex> lock(mux);
+                found_unsat = true;
+                failed      = false;
+                curr_failed = true;
+            }
+            if (curr_failed) {
+                for (unsigned j = 0; j < num_batches; j++)
+                    if (b != j)
+                        managers[j]->limit().cancel();
+            }
+        };
+
+        if (m.has_trace_stream())
+            throw default_exception("threads and trace are incompatible");
+
+        vector<std::thread> threads(num_batches);
+        for (unsigned b = 0; b < num_batches; ++b)
+            threads[b] = std::thread([&, b]() { worker_thread(b); });
+        for (unsigned b = 0; b < num_batches; ++b)
+            threads[b].join();
+
+        if (failed) {
+            switch (ex_kind) {
+            case ERROR_EX: throw z3_error(error_code);
+            case TACTIC_EX: throw tactic_exception(std::move(ex_msg));
+            default: throw default_exception(std::move(ex_msg));
+            }
+        }
+
+        for (unsigned b = 0; b < num_batches; b++) {
+            goal_ref_buffer * r = alloc(goal_ref_buffer);
+            results.set(b, r);
+            ast_translation translator(*(managers[b]), m, false);
+            goal_ref_buffer const & src = *batch_results[b];
+            for (unsigned k = 0; k < src.size(); k++)
+                r->push_back(src[k]->translate(translator));
+        }
+#endif
+
+        merge_results(in, batch_goals, results, result);
+    }
+
+    tactic * translate(ast_manager & m) override {
+        return translate_core<par_components_tactical>(m);
+    }
+};
+
+tactic * par_components(tactic * t) {
+    return alloc(par_components_tactical, t);
+}
+
@@ -59,6 +59,11 @@ tactic * par(tactic * t1, tactic * t2, tactic * t3, tactic * t4);
 tactic * par_and_then(unsigned num, tactic * const * ts);
 tactic * par_and_then(tactic * t1, tactic * t2);
 
+// Split the goal into components that share no uninterpreted symbols and
+// apply t to each component in parallel. The goal is satisfiable iff every
+// component is; component models are merged through the model converters.
+tactic * par_components(tactic * t);
+
 tactic * try_for(tactic * t, unsigned msecs);
 tactic * clean(tactic * t);
 tactic * using_params(tactic * t, params_ref const & p);
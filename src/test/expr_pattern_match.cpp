@@ -0,0 +1,36 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+--*/
+
+#include "util/memory_manager.h"
+#include "params/smt_params.h"
+#include "ast/ast.h"
+#include "ast/arith_decl_plugin.h"
+#include "ast/reg_decl_plugins.h"
+#include "smt/smt_context.h"
+
+// A quantified assertion without patterns exercises pattern inference,
+// which parses the shared pattern database into a private ast_manager.
+// This guards against that manager missing its decl plugins.
+void tst_expr_pattern_match() {
+    memory::initialize(0);
+    smt_params params;
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+
+    sort * int_s = a.mk_int();
+    func_decl_ref f(m.mk_func_decl(symbol("f"), 1, &int_s, int_s), m);
+
+    expr_ref x(m.mk_var(0, int_s), m);
+    expr_ref fx(m.mk_app(f.get(), x.get()), m);
+    expr_ref x2(a.mk_mul(x, a.mk_int(2)), m);
+    expr_ref body(m.mk_eq(fx, x2), m);
+    symbol name("a");
+    expr_ref q(m.mk_forall(1, &int_s, &name, body), m);
+
+    smt::context ctx(m, params);
+    ctx.assert_expr(q);
+    VERIFY(ctx.check() == l_true);
+}
@@ -244,6 +244,7 @@ int main(int argc, char ** argv) {
     TST(polynorm);
     TST(qe_arith);
     TST(expr_substitution);
+    TST(expr_pattern_match);
     TST(sorting_network);
     TST(theory_pb);
     TST(simplex);
@@ -0,0 +1,122 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    async_streambuf.h
+
+Abstract:
+
+    Stream buffer that accumulates output in large blocks and hands the
+    blocks to a dedicated writer thread, so producers of high-volume
+    traces (e.g. DRAT proofs) do not stall on file I/O.
+
+    In SINGLE_THREAD builds the buffer degrades to synchronous
+    large-block writes.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+--*/
+#pragma once
+
+#include <iostream>
+#include "util/vector.h"
+#include "util/mutex.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#include <condition_variable>
+#endif
+
+class async_streambuf : public std::streambuf {
+    static const unsigned BLOCK_SIZE = 1 << 20;
+    std::ostream&  m_dest;
+    svector<char>  m_buffer;
+#ifndef SINGLE_THREAD
+    svector<char>  m_pending;
+    std::mutex     m_mutex;
+    std::condition_variable m_cond;
+    std::thread    m_thread;
+    bool           m_shutdown = false;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_cond.wait(lock, [this] { return m_shutdown || !m_pending.empty(); });
+            if (!m_pending.empty()) {
+                svector<char> block;
+                block.swap(m_pending);
+                lock.unlock();
+                m_dest.write(block.data(), block.size());
+                lock.lock();
+                m_cond.notify_all();
+            }
+            else if (m_shutdown)
+                return;
+        }
+    }
+#endif
+
+    void submit() {
+        if (m_buffer.empty())
+            return;
+#ifdef SINGLE_THREAD
+        m_dest.write(m_buffer.data(), m_buffer.size());
+        m_buffer.reset();
+#else
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // at most one block is in flight; wait for the writer to drain it.
+        m_cond.wait(lock, [this] { return m_pending.empty(); });
+        m_pending.swap(m_buffer);
+        m_buffer.reset();
+        m_cond.notify_all();
+#endif
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (c != traits_type::eof()) {
+            m_buffer.push_back(static_cast<char>(c));
+            if (m_buffer.size() >= BLOCK_SIZE)
+                submit();
+        }
+        return c;
+    }
+
+    std::streamsize xsputn(char const* s, std::streamsize n) override {
+        m_buffer.append(static_cast<unsigned>(n), s);
+        if (m_buffer.size() >= BLOCK_SIZE)
+            submit();
+        return n;
+    }
+
+    int sync() override {
+        submit();
+#ifndef SINGLE_THREAD
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this] { return m_pending.empty(); });
+#endif
+        m_dest.flush();
+        return 0;
+    }
+
+public:
+    async_streambuf(std::ostream& dest): m_dest(dest) {
+#ifndef SINGLE_THREAD
+        m_thread = std::thread([this] { run(); });
+#endif
+    }
+
+    ~async_streambuf() override {
+        sync();
+#ifndef SINGLE_THREAD
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_cond.notify_all();
+        m_thread.join();
+#endif
+    }
+};
@@ -98,23 +98,30 @@ fixed_bit_vector_manager::fill1(fixed_bit_vector& bv) const {
     return bv;
 }
 
-fixed_bit_vector& 
+// the word count is copied into a local so the stores through m_data,
+// which the compiler must assume may alias the manager, do not force a
+// reload of the bound on every iteration; the loops then vectorize.
+
+fixed_bit_vector&
 fixed_bit_vector_manager::set_and(fixed_bit_vector& dst, fixed_bit_vector const& src) const {
-    for (unsigned i = 0; i < m_num_words; i++) 
+    unsigned n = m_num_words;
+    for (unsigned i = 0; i < n; i++)
         dst.m_data[i] &= src.m_data[i];
     return dst;
 }
 
-fixed_bit_vector& 
+fixed_bit_vector&
 fixed_bit_vector_manager::set_or(fixed_bit_vector& dst,  fixed_bit_vector const& src) const {
-    for (unsigned i = 0; i < m_num_words; i++) 
+    unsigned n = m_num_words;
+    for (unsigned i = 0; i < n; i++)
         dst.m_data[i] |= src.m_data[i];
     return dst;
 }
 
-fixed_bit_vector& 
+fixed_bit_vector&
 fixed_bit_vector_manager::set_neg(fixed_bit_vector& dst) const {
-    for (unsigned i = 0; i < m_num_words; i++) 
+    unsigned n = m_num_words;
+    for (unsigned i = 0; i < n; i++)
         dst.m_data[i] = ~dst.m_data[i];
     return dst;
 }
@@ -23,9 +23,17 @@ Notes:
 #include "util/region.h"
 #include "util/map.h"
 #include "util/rational.h"
+#include <atomic>
 
 static DECLARE_MUTEX(gparams_mux);
 
+// Version counter for the global parameter state. It is bumped on every
+// update so that readers can validate thread-local snapshots without
+// taking the lock. Reads vastly outnumber updates: solver construction
+// fetches module parameters on every instantiation while gparams::set is
+// typically confined to startup.
+static std::atomic<unsigned> g_params_version{1};
+
 extern void gparams_register_modules();
 
 static char const * g_old_params_names[] = {
@@ -182,6 +190,7 @@ public:
 
     void reset() {
         lock_guard lock(*gparams_mux);
+        g_params_version.fetch_add(1, std::memory_order_release);
         m_params.reset();
         for (auto & kv : m_module_params) {
             dealloc(kv.m_value);
@@ -394,6 +403,7 @@ public:
         std::string m, p;
         normalize(name, m, p);
         lock_guard lock(*gparams_mux);
+        g_params_version.fetch_add(1, std::memory_order_release);
         if (!m[0]) {
             validate_type(p, value, get_param_descrs());
             set(get_param_descrs(), p, value, m);
@@ -475,7 +485,24 @@ public:
 
     // unfortunately, params_ref is not thread safe
     // so better create a local copy of the parameters.
+    // Each thread keeps a snapshot of the module parameters it reads,
+    // validated against the global version counter, so repeated reads do
+    // not serialize on the lock.
     params_ref get_module(char const* module_name) {
+        struct snapshot {
+            unsigned version = 0;
+            std::vector<std::pair<symbol, params_ref>> entries;
+        };
+        static thread_local snapshot cache;
+        unsigned version = g_params_version.load(std::memory_order_acquire);
+        if (cache.version != version) {
+            cache.entries.clear();
+            cache.version = version;
+        }
+        symbol mod(module_name);
+        for (auto const& [name, p] : cache.entries)
+            if (name == mod)
+                return p;
         params_ref result;
         params_ref * ps = nullptr;
         {
@@ -484,6 +511,7 @@ public:
                 result.copy(*ps);
             }
         }
+        cache.entries.push_back({mod, result});
         return result;
     }
     
@@ -364,7 +364,16 @@ public:
 #define INSERT_LOOP_BODY() {                                                            \
         if (curr->is_used()) {                                                          \
             if (curr->get_hash() == hash && equals(curr->get_data(), e)) {              \
-                curr->set_data(std::move(e));                                           \
+                if (del_entry) {                                                        \
+                    /* compact: move the entry into the earlier tombstone to */         \
+                    /* shorten the probe chain of subsequent lookups.        */         \
+                    del_entry->set_data(std::move(e));                                  \
+                    del_entry->set_hash(hash);                                          \
+                    curr->mark_as_deleted();                                            \
+                }                                                                       \
+                else {                                                                  \
+                    curr->set_data(std::move(e));                                       \
+                }                                                                       \
                 return;                                                                 \
             }                                                                           \
             HS_CODE(m_st_collision++;);                                                 \
@@ -413,7 +422,17 @@ public:
 #define INSERT_LOOP_CORE_BODY() {                                               \
         if (curr->is_used()) {                                                  \
             if (curr->get_hash() == hash && equals(curr->get_data(), e)) {      \
-                et = curr;                                                      \
+                if (del_entry) {                                                \
+                    /* compact: move the entry into the earlier tombstone to */ \
+                    /* shorten the probe chain of subsequent lookups.        */ \
+                    del_entry->set_data(std::move(curr->get_data()));           \
+                    del_entry->set_hash(hash);                                  \
+                    curr->mark_as_deleted();                                    \
+                    et = del_entry;                                             \
+                }                                                               \
+                else {                                                          \
+                    et = curr;                                                  \
+                }                                                               \
                 return false;                                                   \
             }                                                                   \
             HS_CODE(m_st_collision++;);                                         \
@@ -576,9 +595,21 @@ public:
             next = m_table;                          
         }
         if (next->is_free()) {
-            curr->mark_as_free();                                       
-            m_size--;                                                
-        }                                                            
+            curr->mark_as_free();
+            m_size--;
+            // tombstones directly preceding a free slot serve no purpose:
+            // any probe reaching them terminates at the free successor.
+            entry * prev = curr;
+            while (true) {
+                if (prev == m_table)
+                    prev = m_table + m_capacity;
+                --prev;
+                if (!prev->is_deleted())
+                    break;
+                prev->mark_as_free();
+                m_num_deleted--;
+            }
+        }
         else {
             curr->mark_as_deleted();                                    
             m_num_deleted++;
@@ -10,6 +10,14 @@ Abstract:
     Association list from theory id -> var
     where id in [0..255] and var is 24 bit.
 
+    The first cell is stored inline in the owning node, so find() resolves
+    the common single-theory case with one comparison and no pointer chase.
+    The list holds at most one entry per attached theory; entries are
+    region-allocated and removed by theory id (see del_var), which keeps
+    them compatible with trail-based backtracking. A dense node-id indexed
+    side table per theory would not honor partial undo of add_var within
+    a backtracking scope without re-introducing per-entry trail records.
+
 Author:
 
     Leonardo de Moura (leonardo) 2008-02-19.
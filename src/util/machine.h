@@ -25,4 +25,21 @@ Revision History:
 #define PTR_ALIGNMENT 2
 #endif
 
+#if defined(_MSC_VER) && !defined(_M_ARM) && !defined(_M_ARM64)
+#include <intrin.h>
+#endif
+
+/**
+   \brief Hint to move the cache line containing p closer to the processor.
+*/
+inline void machine_prefetch(void const * p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(static_cast<char const*>(p));
+#elif defined(_MSC_VER) && !defined(_M_ARM) && !defined(_M_ARM64)
+    _mm_prefetch(static_cast<char const*>(p), _MM_HINT_T1);
+#else
+    (void)p;
+#endif
+}
+
 
@@ -136,7 +136,18 @@ bool memory::above_high_watermark() {
     return g_memory_watermark < g_memory_alloc_size;
 }
 
-// The following methods are only safe to invoke at 
+bool memory::above_soft_limit() {
+    // Soft limit at 80% of the configured budget (high watermark if set,
+    // otherwise max memory). Gives solvers a chance to shed recoverable
+    // state (learned lemmas, caches) before the hard limit kills the run.
+    long long limit = g_memory_watermark != 0 ? g_memory_watermark : g_memory_max_size;
+    if (limit == 0)
+        return false;
+    lock_guard lock(*g_memory_mux);
+    return (limit / 5) * 4 < g_memory_alloc_size;
+}
+
+// The following methods are only safe to invoke at
 // initialization time, that is, before threads are created.
 
 void memory::set_max_size(size_t max_size) {
@@ -176,6 +187,42 @@ unsigned long long memory::get_allocation_size() {
     return r;
 }
 
+static atomic<long long> g_memory_domain_size[memory::NUM_DOMAINS];
+static atomic<long long> g_memory_domain_max[memory::NUM_DOMAINS];
+
+char const * memory::get_domain_name(domain d) {
+    switch (d) {
+    case DOMAIN_AST:        return "ast";
+    case DOMAIN_SAT_CLAUSE: return "sat clauses";
+    case DOMAIN_EGRAPH:     return "egraph";
+    case DOMAIN_LP:         return "lp";
+    case DOMAIN_MODEL:      return "model";
+    default:                return "other";
+    }
+}
+
+void memory::count_alloc(domain d, size_t s) {
+    long long live = (g_memory_domain_size[d] += static_cast<long long>(s));
+    // racy max update: a concurrent writer may overwrite with a slightly
+    // smaller peak; the watermark stays within one allocation of exact.
+    if (live > g_memory_domain_max[d])
+        g_memory_domain_max[d] = live;
+}
+
+void memory::count_free(domain d, size_t s) {
+    g_memory_domain_size[d] -= static_cast<long long>(s);
+}
+
+unsigned long long memory::get_domain_live_size(domain d) {
+    long long r = g_memory_domain_size[d];
+    return r < 0 ? 0 : r;
+}
+
+unsigned long long memory::get_domain_max_size(domain d) {
+    long long r = g_memory_domain_max[d];
+    return r < 0 ? 0 : r;
+}
+
 unsigned long long memory::get_max_used_memory() {
     unsigned long long r;
     {
@@ -267,6 +314,7 @@ static void synchronize_counters(bool allocating) {
             counts_exceeded = true;
     }
     g_memory_thread_alloc_size = 0;
+    g_memory_thread_alloc_count = 0;
     if (out_of_mem && allocating) {
         throw_out_of_memory();
     }
@@ -54,6 +54,7 @@ public:
     static void initialize(size_t max_size);
     static void set_high_watermark(size_t watermak);
     static bool above_high_watermark();
+    static bool above_soft_limit();
     static void set_max_size(size_t max_size);
     static void set_max_alloc_count(size_t max_count);
     static void finalize(bool shutdown = true);
@@ -70,6 +71,25 @@ public:
     static unsigned long long get_max_used_memory();
     static unsigned long long get_allocation_count();
     static unsigned long long get_max_memory_size();
+
+    // Coarse per-subsystem allocation domains. An allocator owned by a
+    // subsystem is tagged once (e.g. small_object_allocator::set_domain)
+    // and mirrors its size changes here, giving live bytes and
+    // high-watermarks per domain on top of the global counter.
+    enum domain {
+        DOMAIN_AST,
+        DOMAIN_SAT_CLAUSE,
+        DOMAIN_EGRAPH,
+        DOMAIN_LP,
+        DOMAIN_MODEL,
+        DOMAIN_OTHER,
+        NUM_DOMAINS
+    };
+    static char const * get_domain_name(domain d);
+    static void count_alloc(domain d, size_t s);
+    static void count_free(domain d, size_t s);
+    static unsigned long long get_domain_live_size(domain d);
+    static unsigned long long get_domain_max_size(domain d);
     // temporary hack to avoid out-of-memory crash in z3.exe
     static void exit_when_out_of_memory(bool flag, char const * msg);
 };
@@ -20,6 +20,7 @@ Revision History:
 #include<sstream>
 #include<iomanip>
 #include "util/mpf.h"
+#include "util/hwf.h"
 
 mpf::mpf() :
     ebits(0),
@@ -58,9 +59,35 @@ void mpf::swap(mpf & other) noexcept {
 
 mpf_manager::mpf_manager() :
     m_mpz_manager(m_mpq_manager),
+    m_hwf_manager(alloc(hwf_manager)),
     m_powers2(m_mpz_manager) {
 }
 
+mpf_manager::~mpf_manager() {
+    dealloc(m_hwf_manager);
+}
+
+/**
+   \brief Return true if operations on x can be evaluated with hardware doubles.
+
+   The (11, 53) format is IEEE binary64, and mpf values of that format convert
+   to and from doubles without loss, so the host FPU computes the exact same
+   result as the soft-float code for the rounding modes it supports. Round to
+   nearest with ties away from zero has no hardware equivalent and stays on the
+   soft path. The single format is not filtered: evaluating it in hardware
+   doubles is subject to double rounding in the underflow range.
+*/
+bool mpf_manager::is_hw_double(mpf const & x, mpf_rounding_mode rm) const {
+    return x.ebits == 11 && x.sbits == 53 && rm != MPF_ROUND_NEAREST_TAWAY;
+}
+
+void mpf_manager::set_hw_double(hwf const & value, mpf & o) {
+    if (m_hwf_manager->is_nan(value))
+        mk_nan(11, 53, o); // normalize platform-specific NaN payloads.
+    else
+        set(o, 11, 53, m_hwf_manager->to_double(value));
+}
+
 void mpf_manager::set(mpf & o, unsigned ebits, unsigned sbits, int value) {
     static_assert(sizeof(int) == 4, "assume integers are 4 bytes");
 
@@ -459,11 +486,45 @@ bool mpf_manager::gte(mpf const & x, mpf const & y) {
 }
 
 void mpf_manager::add(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
-    add_sub(rm, x, y, o, false);
+    if (is_hw_double(x, rm)) {
+        hwf a, b, r;
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->add(rm, a, b, r);
+        DEBUG_CODE({
+            scoped_mpf c(*this);
+            scoped_mpf h(*this);
+            add_sub(rm, x, y, c, false);
+            set_hw_double(r, h);
+            double cd = to_double(c);
+            double hd = to_double(h);
+            SASSERT(memcmp(&cd, &hd, sizeof(double)) == 0);
+        });
+        set_hw_double(r, o);
+    }
+    else
+        add_sub(rm, x, y, o, false);
 }
 
 void mpf_manager::sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
-    add_sub(rm, x, y, o, true);
+    if (is_hw_double(x, rm)) {
+        hwf a, b, r;
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->sub(rm, a, b, r);
+        DEBUG_CODE({
+            scoped_mpf c(*this);
+            scoped_mpf h(*this);
+            add_sub(rm, x, y, c, true);
+            set_hw_double(r, h);
+            double cd = to_double(c);
+            double hd = to_double(h);
+            SASSERT(memcmp(&cd, &hd, sizeof(double)) == 0);
+        });
+        set_hw_double(r, o);
+    }
+    else
+        add_sub(rm, x, y, o, true);
 }
 
 void mpf_manager::add_sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o, bool sub) {
@@ -578,6 +639,27 @@ void mpf_manager::add_sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mp
 }
 
 void mpf_manager::mul(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
+    if (is_hw_double(x, rm)) {
+        hwf a, b, r;
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->mul(rm, a, b, r);
+        DEBUG_CODE({
+            scoped_mpf c(*this);
+            scoped_mpf h(*this);
+            mul_core(rm, x, y, c);
+            set_hw_double(r, h);
+            double cd = to_double(c);
+            double hd = to_double(h);
+            SASSERT(memcmp(&cd, &hd, sizeof(double)) == 0);
+        });
+        set_hw_double(r, o);
+    }
+    else
+        mul_core(rm, x, y, o);
+}
+
+void mpf_manager::mul_core(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
     TRACE(mpf_mul_bug, tout << "rm: " << rm << "\n";
           tout << "X: " << to_string(x) << "\n";
           tout << "Y: " << to_string(y) << "\n";);
@@ -656,6 +738,27 @@ void mpf_manager::mul(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf &
 }
 
 void mpf_manager::div(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
+    if (is_hw_double(x, rm)) {
+        hwf a, b, r;
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->div(rm, a, b, r);
+        DEBUG_CODE({
+            scoped_mpf c(*this);
+            scoped_mpf h(*this);
+            div_core(rm, x, y, c);
+            set_hw_double(r, h);
+            double cd = to_double(c);
+            double hd = to_double(h);
+            SASSERT(memcmp(&cd, &hd, sizeof(double)) == 0);
+        });
+        set_hw_double(r, o);
+    }
+    else
+        div_core(rm, x, y, o);
+}
+
+void mpf_manager::div_core(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
     SASSERT(x.sbits == y.sbits && x.ebits == y.ebits);
 
     TRACE(mpf_dbg, tout << "X = " << to_string(x) << std::endl;);
@@ -1002,6 +1105,26 @@ void my_mpz_sqrt(unsynch_mpz_manager & m, unsigned sbits, bool odd_exp, mpz & in
 }
 
 void mpf_manager::sqrt(mpf_rounding_mode rm, mpf const & x, mpf & o) {
+    if (is_hw_double(x, rm)) {
+        hwf a, r;
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->sqrt(rm, a, r);
+        DEBUG_CODE({
+            scoped_mpf c(*this);
+            scoped_mpf h(*this);
+            sqrt_core(rm, x, c);
+            set_hw_double(r, h);
+            double cd = to_double(c);
+            double hd = to_double(h);
+            SASSERT(memcmp(&cd, &hd, sizeof(double)) == 0);
+        });
+        set_hw_double(r, o);
+    }
+    else
+        sqrt_core(rm, x, o);
+}
+
+void mpf_manager::sqrt_core(mpf_rounding_mode rm, mpf const & x, mpf & o) {
     SASSERT(x.ebits > 0 && x.sbits > 0);
 
     TRACE(mpf_dbg, tout << "X = " << to_string(x) << std::endl;);
@@ -55,14 +55,19 @@ public:
     void swap(mpf & other) noexcept;
 };
 
+class hwf;
+class hwf_manager;
+
 class mpf_manager {
     unsynch_mpq_manager m_mpq_manager;
     unsynch_mpz_manager & m_mpz_manager; // A mpq_manager is a mpz_manager, reusing it.
+    hwf_manager * m_hwf_manager; // hardware-float filter for the double format, see is_hw_double.
 
 public:
     typedef mpf numeral;
 
     mpf_manager();
+    ~mpf_manager();
 
     void reset(mpf & o, unsigned ebits, unsigned sbits) { set(o, ebits, sbits, 0); }
     void set(mpf & o, unsigned ebits, unsigned sbits, int value);
@@ -219,6 +224,12 @@ protected:
 
     void unpack(mpf & o, bool normalize);
     void add_sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o, bool sub);
+    void mul_core(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o);
+    void div_core(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o);
+    void sqrt_core(mpf_rounding_mode rm, mpf const & x, mpf & o);
+
+    bool is_hw_double(mpf const & x, mpf_rounding_mode rm) const;
+    void set_hw_double(hwf const & value, mpf & o);
     void round(mpf_rounding_mode rm, mpf & o);
     void round_sqrt(mpf_rounding_mode rm, mpf & o);
 
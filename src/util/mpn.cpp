@@ -30,14 +30,21 @@ int mpn_manager::compare(mpn_digit const * a, unsigned lnga,
 
     trace(a, lnga);
 
-    unsigned j = std::max(lnga, lngb);
-    for (; j-- > 0 && res == 0;) {
-        mpn_digit u_j = (j < lnga) ? a[j] : 0;
-        mpn_digit v_j = (j < lngb) ? b[j] : 0;
-        if (u_j > v_j)
+    // digits present in only one operand decide when non-zero; the common
+    // region is then compared without per-digit length checks.
+    for (unsigned j = lnga; res == 0 && j-- > lngb; )
+        if (a[j] != 0)
             res = 1;
-        else if (u_j < v_j)
+    for (unsigned j = lngb; res == 0 && j-- > lnga; )
+        if (b[j] != 0)
             res = -1;
+    if (res == 0) {
+        for (unsigned j = std::min(lnga, lngb); j-- > 0; ) {
+            if (a[j] != b[j]) {
+                res = (a[j] > b[j]) ? 1 : -1;
+                break;
+            }
+        }
     }
 
     TRACE(mpn, tout << ((res == 1) ? " > " : (res == -1) ? " < " : " == "); );
@@ -53,11 +60,19 @@ bool mpn_manager::add(mpn_digit const * a, unsigned lnga,
     trace(a, lnga, b, lngb, "+");
     // Essentially Knuth's Algorithm A
     unsigned len = std::max(lnga, lngb);
-    SASSERT(lngc_alloc == len+1 && len > 0);    
+    unsigned common = std::min(lnga, lngb);
+    SASSERT(lngc_alloc == len+1 && len > 0);
     mpn_digit k = 0;
     mpn_digit r;
     bool c1, c2;
-    for (unsigned j = 0; j < len; j++) {
+    // branch-free over the common region; the tail handles the length
+    // difference with the original per-digit checks.
+    for (unsigned j = 0; j < common; j++) {
+        r = a[j] + b[j]; c1 = r < a[j];
+        c[j] = r + k;    c2 = c[j] < r;
+        k = c1 | c2;
+    }
+    for (unsigned j = common; j < len; j++) {
         mpn_digit u_j = (j < lnga) ? a[j] : 0;
         mpn_digit v_j = (j < lngb) ? b[j] : 0;
         r = u_j + v_j; c1 = r < u_j;
@@ -78,10 +93,18 @@ bool mpn_manager::sub(mpn_digit const * a, unsigned lnga,
     trace(a, lnga, b, lngb, "-");
     // Essentially Knuth's Algorithm S
     unsigned len = std::max(lnga, lngb);
+    unsigned common = std::min(lnga, lngb);
     mpn_digit & k = *pborrow; k = 0;
     mpn_digit r;
     bool c1, c2;
-    for (unsigned j = 0; j < len; j++) {
+    // branch-free over the common region; the tail handles the length
+    // difference with the original per-digit checks.
+    for (unsigned j = 0; j < common; j++) {
+        r = a[j] - b[j]; c1 = r > a[j];
+        c[j] = r - k;    c2 = c[j] > r;
+        k = c1 | c2;
+    }
+    for (unsigned j = common; j < len; j++) {
         mpn_digit u_j = (j < lnga) ? a[j] : 0;
         mpn_digit v_j = (j < lngb) ? b[j] : 0;
         r = u_j - v_j; c1 = r > u_j;
@@ -96,8 +119,18 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
                       mpn_digit const * b, unsigned lngb,
                       mpn_digit * c) const {
     trace(a, lnga, b, lngb, "*");
-    // Essentially Knuth's Algorithm M. 
-    // Perhaps implement a more efficient version, see e.g., Knuth, Section 4.3.3.    
+    if (std::min(lnga, lngb) >= KARATSUBA_THRESHOLD)
+        mul_karatsuba(a, lnga, b, lngb, c);
+    else
+        mul_classic(a, lnga, b, lngb, c);
+    trace_nl(c, lnga+lngb);
+    return true;
+}
+
+void mpn_manager::mul_classic(mpn_digit const * a, unsigned lnga,
+                              mpn_digit const * b, unsigned lngb,
+                              mpn_digit * c) const {
+    // Essentially Knuth's Algorithm M.
     unsigned i;
     mpn_digit k;
 
@@ -107,7 +140,7 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
     for (unsigned i = 0; i < lnga; i++)
         c[i] = 0;
 
-    for (unsigned j = 0; j < lngb; j++) {        
+    for (unsigned j = 0; j < lngb; j++) {
         mpn_digit v_j = b[j];
         if (v_j == 0) { // This branch may be omitted according to Knuth.
             c[j+lnga] = 0;
@@ -117,19 +150,97 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
             for (i = 0; i < lnga; i++) {
                 mpn_digit u_i = a[i];
                 mpn_double_digit t;
-                t = ((mpn_double_digit)u_i * (mpn_double_digit)v_j) + 
-                    (mpn_double_digit) c[i+j] + 
+                t = ((mpn_double_digit)u_i * (mpn_double_digit)v_j) +
+                    (mpn_double_digit) c[i+j] +
                     (mpn_double_digit) k;
-                
+
                 c[i+j] = (t << DIGIT_BITS) >> DIGIT_BITS;
                 k = t >> DIGIT_BITS;
             }
             c[j+lnga] = k;
-        }        
+        }
     }
-    
-    trace_nl(c, lnga+lngb);
-    return true;
+}
+
+// c[0..lngc) += a[0..lnga); the final carry must be absorbed within c.
+void mpn_manager::add_in_place(mpn_digit * c, unsigned lngc,
+                               mpn_digit const * a, unsigned lnga) const {
+    SASSERT(lnga <= lngc);
+    mpn_digit carry = 0;
+    unsigned i = 0;
+    for (; i < lnga; i++) {
+        mpn_double_digit t = (mpn_double_digit)c[i] + (mpn_double_digit)a[i] + carry;
+        c[i] = (mpn_digit)t;
+        carry = (mpn_digit)(t >> DIGIT_BITS);
+    }
+    for (; carry != 0 && i < lngc; i++) {
+        mpn_double_digit t = (mpn_double_digit)c[i] + carry;
+        c[i] = (mpn_digit)t;
+        carry = (mpn_digit)(t >> DIGIT_BITS);
+    }
+    SASSERT(carry == 0);
+}
+
+// c[0..lngc) -= a[0..lnga); the result must be non-negative.
+void mpn_manager::sub_in_place(mpn_digit * c, unsigned lngc,
+                               mpn_digit const * a, unsigned lnga) const {
+    SASSERT(lnga <= lngc);
+    mpn_digit borrow = 0;
+    unsigned i = 0;
+    for (; i < lnga; i++) {
+        mpn_double_digit t = (mpn_double_digit)c[i] - (mpn_double_digit)a[i] - borrow;
+        c[i] = (mpn_digit)t;
+        borrow = (mpn_digit)(t >> DIGIT_BITS) != 0 ? 1 : 0;
+    }
+    for (; borrow != 0 && i < lngc; i++) {
+        mpn_double_digit t = (mpn_double_digit)c[i] - borrow;
+        c[i] = (mpn_digit)t;
+        borrow = (mpn_digit)(t >> DIGIT_BITS) != 0 ? 1 : 0;
+    }
+    SASSERT(borrow == 0);
+}
+
+// Karatsuba multiplication; c must not alias a or b (the classic routine
+// has the same restriction). Recursive calls go through mul(), so small
+// sub-products drop back to the schoolbook routine.
+void mpn_manager::mul_karatsuba(mpn_digit const * a, unsigned lnga,
+                                mpn_digit const * b, unsigned lngb,
+                                mpn_digit * c) const {
+    if (lnga < lngb) {
+        std::swap(a, b);
+        std::swap(lnga, lngb);
+    }
+    unsigned m = (lnga + 1) / 2;
+    if (lngb <= m) {
+        // b only overlaps the low half of a: a*b = ((a >> m)*b << m) + a0*b
+        mul(a, m, b, lngb, c);
+        for (unsigned i = m + lngb; i < lnga + lngb; i++)
+            c[i] = 0;
+        mpn_sbuffer t(lnga - m + lngb, 0);
+        mul(a + m, lnga - m, b, lngb, t.data());
+        add_in_place(c + m, lnga + lngb - m, t.data(), lnga - m + lngb);
+        return;
+    }
+    // a = a1 << m + a0, b = b1 << m + b0 with a0, b0 of m digits.
+    unsigned la1 = lnga - m;
+    unsigned lb1 = lngb - m;
+    // z0 = a0*b0 and z2 = a1*b1 fill c exactly: c = z2 << 2m + z0
+    mul(a, m, b, m, c);
+    mul(a + m, la1, b + m, lb1, c + 2*m);
+    // z1 = (a0 + a1)*(b0 + b1) - z0 - z2 = a0*b1 + a1*b0
+    mpn_sbuffer sa(m + 1, 0), sb(m + 1, 0);
+    unsigned lsa, lsb;
+    add(a, m, a + m, la1, sa.data(), m + 1, &lsa);
+    add(b, m, b + m, lb1, sb.data(), m + 1, &lsb);
+    mpn_sbuffer z1(2*m + 2, 0);
+    mul(sa.data(), m + 1, sb.data(), m + 1, z1.data());
+    sub_in_place(z1.data(), 2*m + 2, c, 2*m);
+    sub_in_place(z1.data(), 2*m + 2, c + 2*m, la1 + lb1);
+    unsigned lz1 = 2*m + 2;
+    while (lz1 > 0 && z1[lz1 - 1] == 0)
+        lz1--;
+    // c += z1 << m; z1 has at most m + la1 + 1 significant digits, so it fits.
+    add_in_place(c + m, lnga + lngb - m, z1.data(), lz1);
 }
 
 #define MASK_FIRST (~((mpn_digit)(-1) >> 1))
@@ -53,6 +53,23 @@ public:
 private:
     using mpn_sbuffer = sbuffer<mpn_digit>;
 
+    // operands with at least this many digits are multiplied with Karatsuba's algorithm
+    static const unsigned KARATSUBA_THRESHOLD = 32;
+
+    void mul_classic(mpn_digit const * a, unsigned lnga,
+                     mpn_digit const * b, unsigned lngb,
+                     mpn_digit * c) const;
+
+    void mul_karatsuba(mpn_digit const * a, unsigned lnga,
+                       mpn_digit const * b, unsigned lngb,
+                       mpn_digit * c) const;
+
+    void add_in_place(mpn_digit * c, unsigned lngc,
+                      mpn_digit const * a, unsigned lnga) const;
+
+    void sub_in_place(mpn_digit * c, unsigned lngc,
+                      mpn_digit const * a, unsigned lnga) const;
+
     void display_raw(std::ostream & out, mpn_digit const * a, unsigned lng) const;
 
     unsigned div_normalize(mpn_digit const * numer, unsigned lnum,
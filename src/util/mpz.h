@@ -417,15 +417,47 @@ public:
 
     static void del(mpz_manager* m, mpz & a);
     
-    void add(mpz const & a, mpz const & b, mpz & c);
+    // the small/small fast paths are inlined so that callers avoid an
+    // out-of-line call for the common case of machine-word operands.
+    void add(mpz const & a, mpz const & b, mpz & c) {
+        if (is_small(a) && is_small(b)) {
+            STRACE(mpz, tout << "[mpz] " << to_string(a) << " + " << to_string(b) << " == " << (i64(a) + i64(b)) << "\n";);
+            set_i64(c, i64(a) + i64(b));
+        }
+        else {
+            add_slow(a, b, c);
+        }
+    }
+
+    void add_slow(mpz const & a, mpz const & b, mpz & c);
+
+    void sub(mpz const & a, mpz const & b, mpz & c) {
+        if (is_small(a) && is_small(b)) {
+            STRACE(mpz, tout << "[mpz] " << to_string(a) << " - " << to_string(b) << " == " << (i64(a) - i64(b)) << "\n";);
+            set_i64(c, i64(a) - i64(b));
+        }
+        else {
+            sub_slow(a, b, c);
+        }
+    }
+
+    void sub_slow(mpz const & a, mpz const & b, mpz & c);
 
-    void sub(mpz const & a, mpz const & b, mpz & c);
-    
     void inc(mpz & a) { add(a, mpz(1), a); }
 
     void dec(mpz & a) { add(a, mpz(-1), a); }
 
-    void mul(mpz const & a, mpz const & b, mpz & c);
+    void mul(mpz const & a, mpz const & b, mpz & c) {
+        if (is_small(a) && is_small(b)) {
+            STRACE(mpz, tout << "[mpz] " << to_string(a) << " * " << to_string(b) << " == " << (i64(a) * i64(b)) << "\n";);
+            set_i64(c, i64(a) * i64(b));
+        }
+        else {
+            mul_slow(a, b, c);
+        }
+    }
+
+    void mul_slow(mpz const & a, mpz const & b, mpz & c);
 
     // d <- a + b*c
     void addmul(mpz const & a, mpz const & b, mpz const & c, mpz & d);
@@ -0,0 +1,102 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    phase_profiler.h
+
+Abstract:
+
+    Always-on scoped phase profiler.
+
+    Accumulates wall clock time and invocation counts for the major
+    solver phases. Unlike timeit/trace instrumentation it is compiled in
+    by default: a scope costs two steady_clock reads, which is negligible
+    relative to the phases being measured. The accumulated times are
+    reported through collect_statistics, so they reach (get-info
+    :all-statistics), /st output, and the solver statistics API without
+    requiring a debug build.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-30
+
+--*/
+#pragma once
+
+#include "util/stopwatch.h"
+#include "util/statistics.h"
+
+class phase_profiler {
+public:
+    enum phase {
+        SIMPLIFY,
+        INTERNALIZE,
+        PROPAGATE,
+        FINAL_CHECK,
+        GC,
+        NUM_PHASES
+    };
+
+private:
+    stopwatch m_watch[NUM_PHASES];
+    uint64_t  m_count[NUM_PHASES] = { 0 };
+    unsigned  m_depth[NUM_PHASES] = { 0 };
+
+    static char const * time_key(phase p) {
+        switch (p) {
+        case SIMPLIFY:    return "time simplify";
+        case INTERNALIZE: return "time internalize";
+        case PROPAGATE:   return "time propagate";
+        case FINAL_CHECK: return "time final check";
+        case GC:          return "time gc";
+        default:          return "time unknown";
+        }
+    }
+
+public:
+    class scope {
+        phase_profiler & m_p;
+        phase            m_phase;
+    public:
+        scope(phase_profiler & p, phase ph): m_p(p), m_phase(ph) {
+            // only the outermost scope of a phase keeps the watch running.
+            if (m_p.m_depth[ph]++ == 0)
+                m_p.m_watch[ph].start();
+            ++m_p.m_count[ph];
+        }
+        ~scope() {
+            if (--m_p.m_depth[m_phase] == 0)
+                m_p.m_watch[m_phase].stop();
+        }
+    };
+
+    void reset() {
+        for (unsigned i = 0; i < NUM_PHASES; ++i) {
+            m_watch[i].reset();
+            m_count[i] = 0;
+        }
+    }
+
+    double get_seconds(phase p) const { return m_watch[p].get_seconds(); }
+
+    uint64_t get_count(phase p) const { return m_count[p]; }
+
+    void collect_statistics(statistics & st) const {
+        for (unsigned i = 0; i < NUM_PHASES; ++i) {
+            if (m_count[i] == 0)
+                continue;
+            st.update(time_key(static_cast<phase>(i)), m_watch[i].get_seconds());
+        }
+    }
+
+    void display(std::ostream & out) const {
+        for (unsigned i = 0; i < NUM_PHASES; ++i) {
+            if (m_count[i] == 0)
+                continue;
+            out << "(" << time_key(static_cast<phase>(i)) << " "
+                << std::fixed << std::setprecision(2) << m_watch[i].get_seconds()
+                << " :count " << m_count[i] << ")\n";
+        }
+    }
+};
@@ -404,19 +404,14 @@ public:
     }
 
     void addmul(rational const & c, rational const & k) {
-        if (c.is_one())
-            operator+=(k);
-        else if (c.is_minus_one())
-            operator-=(k);
-        else if (k.is_one())
+        if (k.is_one())
             operator+=(c);
         else if (k.is_minus_one())
             operator-=(c);
-        else {
-            rational tmp(k);
-            tmp *= c;
-            operator+=(tmp);
-        }
+        else
+            // single manager call: the manager handles the c = +-1 fast
+            // paths and reuses its temporary storage for the product.
+            m().addmul(m_val, c.m_val, k.m_val, m_val);
     }
 
     // Perform:  this -= c * k
@@ -425,11 +420,9 @@ public:
             operator-=(k);
         else if (c.is_minus_one())
             operator+=(k);
-        else {
-            rational tmp(k);
-            tmp *= c;
-            operator-=(tmp);
-        }
+        else
+            // see addmul.
+            m().submul(m_val, c.m_val, k.m_val, m_val);
     }
 
     bool is_int_perfect_square(rational & root) const {
@@ -38,6 +38,7 @@ class reslimit {
     timer                 m_timer;
     unsigned              m_timeout_ms = 0;
     unsigned              m_num_timers = 0;
+    unsigned              m_timer_skip = 0;
 #endif
     svector<uint64_t>     m_limits;
     ptr_vector<reslimit>  m_children;
@@ -47,7 +48,16 @@ class reslimit {
     friend class scoped_suspend_rlimit;
 
 #ifdef POLLING_TIMER
-    bool is_timeout() { return m_timer.ms_timeout(m_timeout_ms) && (inc_cancel(m_num_timers), pop_timeout(), true); }  
+    // reading the clock on every poll is measurable in tight loops;
+    // sample it once every 128 polls instead.
+    bool is_timeout() {
+        if (m_timeout_ms == 0)
+            return false;
+        if (++m_timer_skip < 128)
+            return false;
+        m_timer_skip = 0;
+        return m_timer.ms_timeout(m_timeout_ms) && (inc_cancel(m_num_timers), pop_timeout(), true);
+    }
     void inc_cancel(unsigned k);
 #else
     inline bool is_timeout() { return false; }
@@ -79,8 +89,10 @@ public:
     void set_timeout(unsigned ms) { push_timeout(ms);  }
 #endif
     bool suspended() const { return m_suspend; }
-    inline bool not_canceled() { 
-        return m_suspend || (m_cancel == 0 && m_count <= m_limit && !is_timeout()); 
+    // the cancellation flag is a cooperative signal; a relaxed load suffices
+    // and avoids a fence per poll on weakly ordered architectures.
+    inline bool not_canceled() {
+        return m_suspend || (m_cancel.load(std::memory_order_relaxed) == 0 && m_count <= m_limit && !is_timeout());
     }
     inline bool is_canceled()  { return !not_canceled(); }
     char const* get_cancel_msg() const;
@@ -24,6 +24,7 @@ Revision History:
 #include "util/util.h"
 #include "util/cancel_eh.h"
 #include "util/rlimit.h"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <climits>
@@ -35,43 +36,66 @@ Revision History:
 #include <pthread.h>
 #endif
 
-enum scoped_timer_work_state { IDLE = 0, WORKING = 1, EXITING = 2 };
+// All scoped timeouts are serviced by a single shared timer thread that
+// maintains a min-heap of deadlines. Arming a timeout registers an entry in
+// the heap; disarming it is a compare-and-swap on the entry state. Entries
+// are recycled through a free list, so steady-state registration performs no
+// allocation and no thread setup or teardown.
+
+enum scoped_timer_entry_state { ARMED = 0, FIRING = 1, FIRED = 2, CANCELLED = 3 };
 
 struct scoped_timer_state {
-    std::thread m_thread;
-    std::timed_mutex m_mutex;
+    std::chrono::steady_clock::time_point deadline;
     event_handler * eh;
-    unsigned ms;
-    std::atomic<scoped_timer_work_state> work;
-    std::condition_variable_any cv;
+    std::atomic<scoped_timer_entry_state> state;
 };
 
-static std::vector<scoped_timer_state*> available_workers;
-static std::mutex workers;
-
-static void thread_func(scoped_timer_state *s) {
-    workers.lock();
-    while (true) {
-        s->cv.wait(workers, [=]{ return s->work != IDLE; });
-        workers.unlock();
-
-        if (s->work == EXITING)
-            return;
+static std::mutex timer_mux;
+static std::condition_variable timer_cv;
+static std::vector<scoped_timer_state*> timer_heap;   // min-heap ordered by deadline
+static std::vector<scoped_timer_state*> free_entries; // recycled entries
+static std::thread timer_thread;
+static bool timer_thread_started = false;
+static bool timer_exiting = false;
 
-        auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(s->ms);
+static bool later_deadline(scoped_timer_state const* a, scoped_timer_state const* b) {
+    return a->deadline > b->deadline;
+}
 
-        while (!s->m_mutex.try_lock_until(end)) {
-            if (std::chrono::steady_clock::now() >= end) {
-                s->eh->operator()(TIMEOUT_EH_CALLER);
-                goto next;
-            }
+static void thread_func() {
+    std::unique_lock<std::mutex> lock(timer_mux);
+    while (!timer_exiting) {
+        if (timer_heap.empty()) {
+            timer_cv.wait(lock);
+            continue;
+        }
+        scoped_timer_state * top = timer_heap.front();
+        if (top->state == CANCELLED) {
+            std::pop_heap(timer_heap.begin(), timer_heap.end(), later_deadline);
+            timer_heap.pop_back();
+            free_entries.push_back(top);
+            continue;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (top->deadline > now) {
+            timer_cv.wait_until(lock, top->deadline);
+            continue;
+        }
+        std::pop_heap(timer_heap.begin(), timer_heap.end(), later_deadline);
+        timer_heap.pop_back();
+        scoped_timer_entry_state expected = ARMED;
+        if (top->state.compare_exchange_strong(expected, FIRING)) {
+            // the entry is handed back to the destructor, which recycles it
+            // once it has observed the FIRED state.
+            lock.unlock();
+            top->eh->operator()(TIMEOUT_EH_CALLER);
+            top->state = FIRED;
+            lock.lock();
+        }
+        else {
+            // cancelled concurrently; the destructor no longer owns the entry
+            free_entries.push_back(top);
         }
-
-        s->m_mutex.unlock();
-
-    next:
-        s->work = IDLE;
-        workers.lock();
     }
 }
 
@@ -88,34 +112,41 @@ scoped_timer::scoped_timer(unsigned ms, event_handler * eh) {
         return;
     }
 #endif
-    workers.lock();
-    if (available_workers.empty()) {
-        // start new thead
-        workers.unlock();
-        s = new scoped_timer_state;
-        init_state(ms, eh);
-        s->m_thread = std::thread(thread_func, s);
-    }
-    else {
-        // re-use existing thread
-        s = available_workers.back();
-        available_workers.pop_back();
+    {
+        std::lock_guard<std::mutex> lock(timer_mux);
+        if (free_entries.empty()) {
+            s = new scoped_timer_state;
+        }
+        else {
+            s = free_entries.back();
+            free_entries.pop_back();
+        }
         init_state(ms, eh);
-        workers.unlock();
-        s->cv.notify_one();
+        timer_heap.push_back(s);
+        std::push_heap(timer_heap.begin(), timer_heap.end(), later_deadline);
+        if (!timer_thread_started) {
+            timer_thread_started = true;
+            timer_thread = std::thread(thread_func);
+        }
     }
+    timer_cv.notify_one();
 }
-    
+
 scoped_timer::~scoped_timer() {
     if (!s)
         return;
 
-    s->m_mutex.unlock();
-    while (s->work == WORKING)
+    scoped_timer_entry_state expected = ARMED;
+    if (s->state.compare_exchange_strong(expected, CANCELLED)) {
+        // the timer thread recycles the entry when it reaches the heap top
+        return;
+    }
+    // the handler is firing or has fired; wait until the timer thread is
+    // done with the entry, then recycle it.
+    while (s->state != FIRED)
         std::this_thread::yield();
-    workers.lock();
-    available_workers.push_back(s);
-    workers.unlock();
+    std::lock_guard<std::mutex> lock(timer_mux);
+    free_entries.push_back(s);
 }
 
 void scoped_timer::initialize() {
@@ -129,24 +160,31 @@ void scoped_timer::initialize() {
 }
 
 void scoped_timer::finalize() {
-    workers.lock();
-    for (auto w : available_workers) {
-        w->work = EXITING;
-        w->cv.notify_one();
-    }
-    decltype(available_workers) cleanup_workers;
-    std::swap(available_workers, cleanup_workers);
-    workers.unlock();
-
-    for (auto w : cleanup_workers) {
-        w->m_thread.join();
-        delete w;
+    bool started;
+    {
+        std::lock_guard<std::mutex> lock(timer_mux);
+        started = timer_thread_started;
+        timer_exiting = true;
     }
+    timer_cv.notify_one();
+    if (started)
+        timer_thread.join();
+    std::lock_guard<std::mutex> lock(timer_mux);
+    for (auto e : timer_heap)
+        if (e->state == CANCELLED)
+            // ownerless entry; entries with a live scoped_timer are leaked,
+            // matching the previous behavior of finalizing with active timers
+            delete e;
+    timer_heap.clear();
+    for (auto e : free_entries)
+        delete e;
+    free_entries.clear();
+    timer_thread_started = false;
+    timer_exiting = false;
 }
 
 void scoped_timer::init_state(unsigned ms, event_handler * eh) {
-    s->ms = ms;
+    s->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
     s->eh = eh;
-    s->m_mutex.lock();
-    s->work = WORKING;
+    s->state = ARMED;
 }
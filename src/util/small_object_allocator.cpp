@@ -41,6 +41,8 @@ small_object_allocator::small_object_allocator(char const * id) {
 }
 
 small_object_allocator::~small_object_allocator() {
+    if (m_domain != memory::DOMAIN_OTHER)
+        memory::count_free(m_domain, m_alloc_size);
     for (unsigned i = 0; i < NUM_SLOTS; i++) {
         chunk * c = m_chunks[i];
         while (c) {
@@ -67,6 +69,8 @@ void small_object_allocator::reset() {
         m_chunks[i] = nullptr;
         m_free_list[i] = nullptr;
     }
+    if (m_domain != memory::DOMAIN_OTHER)
+        memory::count_free(m_domain, m_alloc_size);
     m_alloc_size = 0;
 }
 
@@ -84,6 +88,8 @@ void small_object_allocator::deallocate(size_t size, void * p) {
     SASSERT(m_alloc_size >= size);
     SASSERT(p);
     m_alloc_size -= size;
+    if (m_domain != memory::DOMAIN_OTHER)
+        memory::count_free(m_domain, size);
     if (size >= SMALL_OBJ_SIZE - (1 << PTR_ALIGNMENT)) {
         memory::deallocate(p);
         return;
@@ -109,6 +115,8 @@ void * small_object_allocator::allocate(size_t size) {
     return memory::allocate(size);
 #endif
     m_alloc_size += size;
+    if (m_domain != memory::DOMAIN_OTHER)
+        memory::count_alloc(m_domain, size);
     if (size >= SMALL_OBJ_SIZE - (1 << PTR_ALIGNMENT)) {
         return memory::allocate(size);
     }
@@ -22,6 +22,7 @@ Revision History:
 #include "util/machine.h"
 #include "util/debug.h"
 #include "util/trace.h"
+#include "util/memory_manager.h"
 
 class small_object_allocator {
     static const unsigned CHUNK_SIZE     = (8192 - sizeof(void*)*2);
@@ -35,12 +36,15 @@ class small_object_allocator {
     chunk *     m_chunks[NUM_SLOTS];
     void  *     m_free_list[NUM_SLOTS];
     size_t      m_alloc_size;
+    memory::domain m_domain = memory::DOMAIN_OTHER;
 #ifdef Z3DEBUG
     char const * m_id;
 #endif
 public:
     small_object_allocator(char const * id = "unknown");
     ~small_object_allocator();
+    // attribute this allocator's bytes to a per-subsystem accounting domain.
+    void set_domain(memory::domain d) { m_domain = d; }
     void reset();
     void * allocate(size_t size);
     void deallocate(size_t size, void * p);
@@ -19,6 +19,7 @@ Notes:
 
 --*/
 
+#include "util/map.h"
 #include "util/vector.h"
 
 #pragma once
@@ -195,6 +196,17 @@ Notes:
         static const bool m_force_dsorting   = false;
         static const bool m_force_dsmerge    = false;
 
+        // Memoized verdicts of the encoding selection heuristics.
+        // The vc_* cost estimates are evaluated recursively at every
+        // branch point of card/sorting/merge, and formulas with
+        // thousands of same-shape cardinality constraints re-run the
+        // same estimations. The verdicts only depend on the dimensions
+        // and the comparison kind, so they are cached for the lifetime
+        // of the network builder.
+        u_map<bool>  m_use_dcard_cache;
+        u_map<bool>  m_use_dsorting_cache;
+        u_map<bool>  m_use_dsmerge_cache;
+
         bool is_power_of2(unsigned n) const {
             return n != 0 && ((n-1) & n) == 0;
         }
@@ -1072,7 +1084,14 @@ Notes:
             return vc_card(k, l) + vc_card(k, n-l) + vc_smerge(k, l, n-l);
         }
         bool use_dcard(unsigned k, unsigned n) {
-            return m_force_dcard || (!m_disable_dcard && n < 10 && vc_dsorting(k, n) < vc_card_rec(k, n));
+            if (m_force_dcard) return true;
+            if (m_disable_dcard || n >= 10) return false;
+            unsigned key = k | (n << 4) | (static_cast<unsigned>(m_t) << 8);
+            bool r;
+            if (m_use_dcard_cache.find(key, r)) return r;
+            r = vc_dsorting(k, n) < vc_card_rec(k, n);
+            m_use_dcard_cache.insert(key, r);
+            return r;
         }
 
 
@@ -1247,9 +1266,15 @@ Notes:
         }
 
         bool use_dsorting(unsigned n) {
-            SASSERT(n > 2);            
-            return m_force_dsorting || 
-                (!m_disable_dsorting && n < 10 && vc_dsorting(n, n) < vc_sorting_rec(n));
+            SASSERT(n > 2);
+            if (m_force_dsorting) return true;
+            if (m_disable_dsorting || n >= 10) return false;
+            unsigned key = n | (static_cast<unsigned>(m_t) << 4);
+            bool r;
+            if (m_use_dsorting_cache.find(key, r)) return r;
+            r = vc_dsorting(n, n) < vc_sorting_rec(n);
+            m_use_dsorting_cache.insert(key, r);
+            return r;
         }
 
         void smerge(unsigned c,
@@ -1364,11 +1389,15 @@ Notes:
                 ((m_t != LE)?vc(0, 1):vc(0, 0));
         }
         bool use_dsmerge(unsigned a, unsigned b, unsigned c) {
-            return 
-                m_force_dsmerge ||
-                (!m_disable_dsmerge && 
-                 a < 10 && b < 10 && 
-                 vc_dsmerge(a, b, a + b) < vc_smerge_rec(a, b, c));
+            if (m_force_dsmerge) return true;
+            if (m_disable_dsmerge || a >= 10 || b >= 10) return false;
+            // c <= a + b < 20, so the dimensions pack into one key
+            unsigned key = a | (b << 4) | (c << 8) | (static_cast<unsigned>(m_t) << 16);
+            bool r;
+            if (m_use_dsmerge_cache.find(key, r)) return r;
+            r = vc_dsmerge(a, b, a + b) < vc_smerge_rec(a, b, c);
+            m_use_dsmerge_cache.insert(key, r);
+            return r;
         }
 
         void dsmerge(            
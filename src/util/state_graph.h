@@ -103,6 +103,17 @@ private:
     edge_rel   m_targets;
     edge_rel   m_sources_maybecycle;
 
+    /*
+        Bound on the number of states explored by a single cycle
+        search in merge_all_cycles. A truncated search merges fewer
+        states than possible, which is sound, but some cycles of
+        unknown states may survive, making dead-state detection
+        incomplete. m_cycle_frontier_truncated records whether any
+        search was truncated.
+    */
+    unsigned   m_max_cycle_frontier = 10000;
+    bool       m_cycle_frontier_truncated = false;
+
     /* 
         Pretty printer for states 
     */
@@ -132,6 +143,7 @@ private:
         - every state with a dead source is dead
         - every state with only dead targets is dead
         - there are no cycles of unknown states on maybecycle edges
+          (waived once a cycle search has been truncated)
     */
     #ifdef Z3DEBUG
     bool is_subset(state_set set1, state_set set2) const;
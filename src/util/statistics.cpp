@@ -45,13 +45,8 @@ void statistics::reset() {
 
 template<typename V, typename M>
 static void mk_map(V const & v, M & m) {
-    for (auto const& p : v) {
-        typename V::data_t::second_type val;
-        if (m.find(p.first, val)) 
-            m.insert(p.first, p.second + val);
-        else
-            m.insert(p.first, p.second);
-    }
+    for (auto const& p : v)
+        m.insert_if_not_there(p.first, 0) += p.second;
 }
 
 template<typename M>
@@ -236,9 +231,21 @@ void get_memory_statistics(statistics& st) {
     unsigned long long mem = memory::get_allocation_size();
     max_mem = (100*max_mem)/(1024*1024);
     mem = (100*mem)/(1024*1024);
-    st.update("max memory", static_cast<double>(max_mem)/100.0);    
+    st.update("max memory", static_cast<double>(max_mem)/100.0);
     st.update("memory", static_cast<double>(mem)/100.0);
     get_uint64_stats(st, "num allocs",  memory::get_allocation_count());
+    for (unsigned i = 0; i < memory::NUM_DOMAINS; ++i) {
+        memory::domain d = static_cast<memory::domain>(i);
+        unsigned long long dmax = memory::get_domain_max_size(d);
+        if (dmax == 0)
+            continue;
+        unsigned long long dmem = (100 * memory::get_domain_live_size(d)) / (1024 * 1024);
+        dmax = (100 * dmax) / (1024 * 1024);
+        // statistics does not copy keys, so intern them as symbols.
+        std::string name(memory::get_domain_name(d));
+        st.update(symbol(("memory " + name).c_str()).bare_str(), static_cast<double>(dmem)/100.0);
+        st.update(symbol(("max memory " + name).c_str()).bare_str(), static_cast<double>(dmax)/100.0);
+    }
 }
 
 void get_rlimit_statistics(reslimit& l, statistics& st) {
@@ -22,6 +22,14 @@ Notes:
 #include "util/vector.h"
 #include "util/rlimit.h"
 
+/**
+   \brief Keyed view over counters, built on demand.
+
+   Hot paths should not call update directly; engines keep plain unsigned
+   members in a local stats struct (see e.g. sat::solver::m_stats) and
+   materialize them here only when collect_statistics is invoked.
+   Keys are not copied: pass string literals or interned symbols.
+*/
 class statistics {
     typedef std::pair<char const *, unsigned> key_val_pair;
     svector<key_val_pair>   m_stats;
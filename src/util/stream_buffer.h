@@ -23,20 +23,38 @@ Revision History:
 #include<istream>
 
 class stream_buffer {
+    static const unsigned BUFFER_SIZE = 8192;
     std::istream & m_stream;
     int            m_val;
+    unsigned       m_pos = 0;
+    unsigned       m_end = 0;
+    char           m_buffer[BUFFER_SIZE];
+
+    int next_char() {
+        // refill in blocks; per-character istream::get is a measurable
+        // cost on large inputs.
+        if (m_pos == m_end) {
+            m_stream.read(m_buffer, BUFFER_SIZE);
+            m_end = static_cast<unsigned>(m_stream.gcount());
+            m_pos = 0;
+            if (m_end == 0)
+                return EOF;
+        }
+        return static_cast<unsigned char>(m_buffer[m_pos++]);
+    }
+
 public:
-    
+
     stream_buffer(std::istream & s):
         m_stream(s) {
-        m_val = m_stream.get();
+        m_val = next_char();
     }
 
-    int  operator *() const { 
+    int  operator *() const {
         return m_val;
     }
 
-    void operator ++() { 
-        m_val = m_stream.get();
+    void operator ++() {
+        m_val = next_char();
     }
 };
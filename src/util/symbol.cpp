@@ -52,13 +52,12 @@ public:
         DEALLOC_MUTEX(lock);
     }
 
-    char const * get_str(char const * d) {
+    char const * get_str(char const * d, size_t l) {
         const char * result;
         lock_guard _lock(*lock);
         str_hashtable::entry * e;
         if (m_table.insert_if_not_there_core(d, e)) {
             // new entry
-            size_t l   = strlen(d);
             // store the hash-code before the string
             size_t * mem = static_cast<size_t*>(m_region.allocate(l + 1 + sizeof(size_t)));
             *mem = e->get_hash();
@@ -74,6 +73,10 @@ public:
         SASSERT(m_table.contains(result));
         return result;
     }
+
+    char const * get_str(char const * d) {
+        return get_str(d, strlen(d));
+    }
 };
 }
 
@@ -109,8 +112,11 @@ struct internal_symbol_tables {
     }
 
     char const * get_str(char const * d) {
-        auto* table = tables[string_hash(d, static_cast<unsigned>(strlen(d)), 251) % sz];
-        return table->get_str(d);
+        size_t l = strlen(d);
+        // mix the hash before selecting a shard so the shard index is
+        // decorrelated from the bucket index used inside the shard table.
+        auto* table = tables[hash_u(string_hash(d, static_cast<unsigned>(l), 17)) % sz];
+        return table->get_str(d, l);
     }
 };
 
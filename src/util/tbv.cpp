@@ -203,8 +203,23 @@ tbv& tbv_manager::set_or(tbv& dst,  tbv const& src) const {
     return dst;
 }
 bool tbv_manager::set_and(tbv& dst,  tbv const& src) const {
-    m.set_and(dst, src); 
-    return is_well_formed(dst);
+    // the intersection and the well-formedness check (no bit position
+    // collapses to the empty value 00) are fused into a single pass so
+    // dst is not traversed twice.
+    unsigned nw = m.num_words();
+    if (nw == 0)
+        return true;
+    unsigned ok = 0xFFFFFFFF;
+    for (unsigned i = 0; i + 1 < nw; ++i) {
+        unsigned w = dst.m_data[i] & src.m_data[i];
+        dst.m_data[i] = w;
+        ok &= w | (w << 1) | 0x55555555;
+    }
+    unsigned w = dst.m_data[nw-1] & src.m_data[nw-1];
+    dst.m_data[nw-1] = w;
+    w &= m.get_mask();
+    ok &= w | (w << 1) | 0x55555555 | ~m.get_mask();
+    return ok == 0xFFFFFFFF;
 }
 
 bool tbv_manager::is_well_formed(tbv const& dst) const {
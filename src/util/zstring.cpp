@@ -14,6 +14,7 @@ Author:
     Nikolaj Bjorner (nbjorner) 2021-01-26
 
 --*/
+#include <cstring>
 #include "util/gparams.h"
 #include "util/zstring.h"
 
@@ -166,33 +167,28 @@ std::string zstring::encode() const {
 
 bool zstring::suffixof(zstring const& other) const {
     if (length() > other.length()) return false;
-    bool suffix = true;
-    for (unsigned i = 0; suffix && i < length(); ++i) {
-        suffix = m_buffer[length()-i-1] == other[other.length()-i-1];
-    }
-    return suffix;
+    return length() == 0 ||
+        0 == memcmp(m_buffer.data(), other.m_buffer.data() + other.length() - length(), length() * sizeof(uint32_t));
 }
 
 bool zstring::prefixof(zstring const& other) const {
     if (length() > other.length()) return false;
-    bool prefix = true;
-    for (unsigned i = 0; prefix && i < length(); ++i) {
-        prefix = m_buffer[i] == other[i];
-    }
-    return prefix;
+    return length() == 0 ||
+        0 == memcmp(m_buffer.data(), other.m_buffer.data(), length() * sizeof(uint32_t));
 }
 
 bool zstring::contains(zstring const& other) const {
     if (other.length() > length()) return false;
+    if (other.length() == 0) return true;
     unsigned last = length() - other.length();
-    bool cont = false;
-    for (unsigned i = 0; !cont && i <= last; ++i) {
-        cont = true;
-        for (unsigned j = 0; cont && j < other.length(); ++j) {
-            cont = other[j] == m_buffer[j+i];
-        }
+    uint32_t const* data = m_buffer.data();
+    uint32_t const* pat  = other.m_buffer.data();
+    size_t pat_bytes = other.length() * sizeof(uint32_t);
+    for (unsigned i = 0; i <= last; ++i) {
+        if (data[i] == pat[0] && 0 == memcmp(data + i, pat, pat_bytes))
+            return true;
     }
-    return cont;
+    return false;
 }
 
 int zstring::indexofu(zstring const& other, unsigned offset) const {
@@ -201,14 +197,12 @@ int zstring::indexofu(zstring const& other, unsigned offset) const {
     if (offset > other.length() + offset) return -1;
     if (other.length() + offset > length()) return -1;
     unsigned last = length() - other.length();
+    uint32_t const* data = m_buffer.data();
+    uint32_t const* pat  = other.m_buffer.data();
+    size_t pat_bytes = other.length() * sizeof(uint32_t);
     for (unsigned i = offset; i <= last; ++i) {
-        bool prefix = true;
-        for (unsigned j = 0; prefix && j < other.length(); ++j) {
-            prefix = m_buffer[i + j] == other[j];
-        }
-        if (prefix) {
+        if (data[i] == pat[0] && 0 == memcmp(data + i, pat, pat_bytes))
             return static_cast<int>(i);
-        }
     }
     return -1;
 }
@@ -216,14 +210,12 @@ int zstring::indexofu(zstring const& other, unsigned offset) const {
 int zstring::last_indexof(zstring const& other) const {
     if (other.length() == 0) return length();
     if (other.length() > length()) return -1;
+    uint32_t const* data = m_buffer.data();
+    uint32_t const* pat  = other.m_buffer.data();
+    size_t pat_bytes = other.length() * sizeof(uint32_t);
     for (unsigned last = length() - other.length() + 1; last-- > 0; ) {
-        bool suffix = true;
-        for (unsigned j = 0; suffix && j < other.length(); ++j) {
-            suffix = m_buffer[last + j] == other[j];
-        }
-        if (suffix) {
+        if (data[last] == pat[0] && 0 == memcmp(data + last, pat, pat_bytes))
             return static_cast<int>(last);
-        }
     }
     return -1;
 }
@@ -231,10 +223,9 @@ int zstring::last_indexof(zstring const& other) const {
 zstring zstring::extract(unsigned offset, unsigned len) const {
     zstring result;
     if (offset + len < offset) return result;
-    int last = std::min(offset+len, length());
-    for (int i = offset; i < last; ++i) {
-        result.m_buffer.push_back(m_buffer[i]);
-    }
+    unsigned last = std::min(offset + len, length());
+    if (offset < last)
+        result.m_buffer.append(last - offset, m_buffer.data() + offset);
     return result;
 }
 
@@ -242,24 +233,25 @@ unsigned zstring::hash() const {
     return unsigned_ptr_hash(m_buffer.data(), m_buffer.size(), 23);
 }
 
-zstring zstring::operator+(zstring const& other) const {
+zstring zstring::operator+(zstring const& other) const & {
     zstring result(*this);
     result.m_buffer.append(other.m_buffer);
     return result;
 }
 
+zstring zstring::operator+(zstring const& other) && {
+    m_buffer.append(other.m_buffer);
+    return std::move(*this);
+}
+
 
 bool zstring::operator==(const zstring& other) const {
     // two strings are equal iff they have the same length and characters
     if (length() != other.length()) {
         return false;
     }
-    for (unsigned i = 0; i < length(); ++i) {
-        if (m_buffer[i] != other[i]) {
-            return false;
-        }
-    }
-    return true;
+    return length() == 0 ||
+        0 == memcmp(m_buffer.data(), other.m_buffer.data(), length() * sizeof(uint32_t));
 }
 
 bool zstring::operator!=(const zstring& other) const {
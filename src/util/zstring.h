@@ -80,7 +80,9 @@ public:
     int  indexofu(zstring const& other, unsigned offset) const;
     int  last_indexof(zstring const& other) const;
     zstring extract(unsigned offset, unsigned length) const;
-    zstring operator+(zstring const& other) const;
+    zstring operator+(zstring const& other) const &;
+    // reuses the temporary's buffer so left-folded concatenation chains stay linear.
+    zstring operator+(zstring const& other) &&;
     bool operator==(const zstring& other) const;
     bool operator!=(const zstring& other) const;
     unsigned hash() const;